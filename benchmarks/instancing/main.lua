@@ -0,0 +1,82 @@
+-- Draws 10k spinning quads, first with one love.graphics.draw per quad and then
+-- with a single love.graphics.drawInstanced. Each mode runs for FRAMES frames and
+-- the averaged frame time, draw time and draw calls are printed. Switch only.
+
+local QUADS  = 10000
+local FRAMES = 300
+
+local modes = { "draw", "drawInstanced" }
+
+local texture
+local instances
+local positions = {}
+
+local mode    = 1
+local frame   = 0
+local results = {}
+
+local function reset()
+    results[mode] = { frameTime = 0, drawTime = 0, drawcalls = 0 }
+end
+
+function love.load()
+    local data = love.image.newImageData(4, 4)
+    data:mapPixel(function() return 1, 1, 1, 1 end)
+
+    texture   = love.graphics.newImage(data)
+    instances = love.graphics.newInstanceBuffer(QUADS, "stream")
+
+    local width, height = love.graphics.getDimensions()
+
+    for index = 1, QUADS do
+        positions[index] = { love.math.random(0, width), love.math.random(0, height) }
+    end
+
+    reset()
+end
+
+function love.update(dt)
+    local result = results[mode]
+    result.frameTime = result.frameTime + dt
+
+    frame = frame + 1
+
+    if frame == FRAMES then
+        print(("instancing: %-13s frame %.3f ms, draw %.3f ms, %d draw calls"):format(modes[mode],
+              result.frameTime / FRAMES * 1000, result.drawTime / FRAMES * 1000,
+              result.drawcalls / FRAMES))
+
+        if mode == #modes then
+            return love.event.quit()
+        end
+
+        mode, frame = mode + 1, 0
+        reset()
+    end
+end
+
+function love.draw()
+    local angle  = love.timer.getTime()
+    local result = results[mode]
+
+    local start = love.timer.getTime()
+
+    if modes[mode] == "draw" then
+        for index = 1, QUADS do
+            local position = positions[index]
+            love.graphics.draw(texture, position[1], position[2], angle)
+        end
+    else
+        for index = 1, QUADS do
+            local position = positions[index]
+            instances:setInstance(index, position[1], position[2], angle)
+        end
+
+        love.graphics.drawInstanced(texture, QUADS, instances)
+    end
+
+    result.drawTime  = result.drawTime + (love.timer.getTime() - start)
+    result.drawcalls = result.drawcalls + love.graphics.getStats().drawcalls
+
+    love.graphics.print(("%s: %d FPS"):format(modes[mode], love.timer.getFPS()), 10, 10)
+end
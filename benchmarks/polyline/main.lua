@@ -0,0 +1,75 @@
+-- Draws a 10k-segment polyline under every line join and style. Each case runs
+-- for FRAMES frames and the averaged frame time and line draw time are printed.
+
+local SEGMENTS = 10000
+local FRAMES   = 120
+
+local cases = {}
+
+for _, join in ipairs({ "none", "bevel", "miter" }) do
+    for _, style in ipairs({ "rough", "smooth" }) do
+        table.insert(cases, { join = join, style = style })
+    end
+end
+
+local points = {}
+
+local current = 1
+local frame   = 0
+local results = {}
+
+local function reset()
+    results[current] = { frameTime = 0, drawTime = 0 }
+end
+
+function love.load()
+    local width, height = love.graphics.getDimensions()
+
+    for index = 0, SEGMENTS do
+        local x = index / SEGMENTS * width
+        local y = height * 0.5 + math.sin(index * 0.25) * height * 0.4
+
+        table.insert(points, x)
+        table.insert(points, y)
+    end
+
+    love.graphics.setLineWidth(2)
+
+    reset()
+end
+
+function love.update(dt)
+    local result = results[current]
+    result.frameTime = result.frameTime + dt
+
+    frame = frame + 1
+
+    if frame == FRAMES then
+        local case = cases[current]
+
+        print(("polyline: %-5s %-6s frame %.3f ms, line %.3f ms"):format(case.join, case.style,
+              result.frameTime / FRAMES * 1000, result.drawTime / FRAMES * 1000))
+
+        if current == #cases then
+            return love.event.quit()
+        end
+
+        current, frame = current + 1, 0
+        reset()
+    end
+end
+
+function love.draw()
+    local case   = cases[current]
+    local result = results[current]
+
+    love.graphics.setLineJoin(case.join)
+    love.graphics.setLineStyle(case.style)
+
+    local start = love.timer.getTime()
+    love.graphics.line(points)
+    result.drawTime = result.drawTime + (love.timer.getTime() - start)
+
+    love.graphics.print(("%s/%s: %d FPS"):format(case.join, case.style, love.timer.getFPS()),
+                        10, 10)
+end
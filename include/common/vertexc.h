@@ -0,0 +1,22 @@
+#pragma once
+
+#include <vector>
+
+namespace vertex
+{
+    /*
+    ** How often the contents of a
+    ** persistent vertex buffer change
+    */
+    enum Usage
+    {
+        USAGE_STREAM,
+        USAGE_DYNAMIC,
+        USAGE_STATIC,
+        USAGE_MAX_ENUM
+    };
+
+    bool GetConstant(const char* in, Usage& out);
+    bool GetConstant(Usage in, const char*& out);
+    std::vector<const char*> GetConstants(Usage);
+} // namespace vertex
@@ -32,6 +32,12 @@
 #include "objects/text/text.h"
 #include "objects/text/wrap_text.h"
 
+#include "objects/spritebatch/spritebatch.h"
+#include "objects/spritebatch/wrap_spritebatch.h"
+
+#include "objects/particlesystem/particlesystem.h"
+#include "objects/particlesystem/wrap_particlesystem.h"
+
 #include "modules/font/fontmodule.h"
 
 #include "objects/imagedata/imagedata.h"
@@ -48,6 +54,12 @@
     #include "deko3d/vertex.h"
 
     #include "objects/shader/wrap_shader.h"
+
+    #include "objects/mesh/mesh.h"
+    #include "objects/mesh/wrap_mesh.h"
+
+    #include "objects/instancebuffer/instancebuffer.h"
+    #include "objects/instancebuffer/wrap_instancebuffer.h"
 #endif
 
 namespace love
@@ -116,6 +128,36 @@ namespace love
             std::string device;
         };
 
+        /*
+        ** Draw counters are for the frame in progress and are
+        ** reset on Present, high-water marks are kept since boot
+        ** skippedBinds counts state changes that were already in effect
+        ** flushes counts how often the pending batch was sent to the GPU
+        ** vertexHighWater is in vertices, the rest are in bytes
+        */
+        struct Stats
+        {
+            int drawCalls;
+            int drawCallsBatched;
+            int canvasSwitches;
+            int shaderSwitches;
+            int textureBinds;
+            int vertices;
+            int skippedBinds;
+            int flushes;
+            int canvases;
+            int images;
+            int fonts;
+            int descriptors;
+            int evictions;
+            int restores;
+            int64_t textureMemory;
+            int64_t evictedMemory;
+            int64_t vertexHighWater;
+            int64_t commandHighWater;
+            std::vector<std::pair<const char*, int64_t>> pools;
+        };
+
         enum StackType
         {
             STACK_ALL,
@@ -266,7 +308,8 @@ namespace love
 
         /* Objects */
 
-        Image* NewImage(const Image::Slices& data);
+        Image* NewImage(const Image::Slices& data,
+                        const Image::Settings& settings = Image::Settings());
 
         virtual Font* NewFont(Rasterizer* rasterizer,
                               const Texture::Filter& filter = Texture::defaultFilter) = 0;
@@ -286,6 +329,18 @@ namespace love
 
         Text* NewText(Font* font, const std::vector<Font::ColoredString>& text = {});
 
+        SpriteBatch* NewSpriteBatch(Texture* texture, int size, vertex::Usage usage);
+
+        ParticleSystem* NewParticleSystem(Texture* texture, uint32_t size);
+
+#if defined(__SWITCH__)
+        Mesh* NewMesh(const std::vector<Mesh::AttributeFormat>& format,
+                      const std::vector<vertex::Vertex>& vertices, Mesh::DrawMode mode,
+                      vertex::Usage usage);
+
+        InstanceBuffer* NewInstanceBuffer(size_t size, vertex::Usage usage);
+#endif
+
         void SetFont(Font* font);
 
         Font* GetFont();
@@ -311,6 +366,13 @@ namespace love
         void Draw(Drawable* drawable, const Matrix4& matrix);
         void Draw(Texture* texture, Quad* quad, const Matrix4& matrix);
 
+#if defined(__SWITCH__)
+        void DrawInstanced(Mesh* mesh, InstanceBuffer* instances, int count,
+                           const Matrix4& matrix);
+        void DrawInstanced(Texture* texture, InstanceBuffer* instances, int count,
+                           const Matrix4& matrix);
+#endif
+
         void Print(const std::vector<Font::ColoredString>& strings, const Matrix4& localTransform);
         void Print(const std::vector<Font::ColoredString>& strings, Font* font,
                    const Matrix4& localTransform);
@@ -392,6 +454,8 @@ namespace love
 
         virtual RendererInfo GetRendererInfo() const = 0;
 
+        virtual Stats GetStats() const;
+
         Vector2 TransformPoint(Vector2 point);
 
         Vector2 InverseTransformPoint(Vector2 point);
@@ -548,16 +612,6 @@ namespace love
             Graphics* gfx;
         };
 
-        struct Stats
-        {
-            int drawCalls;
-            int canvasSwitches;
-            int shaderSwitches;
-            int canvases;
-            int images;
-            int fonts;
-        };
-
         void PushTransform();
 
         void PopTransform();
@@ -31,6 +31,10 @@ namespace Wrap_Graphics
 
     int Draw(lua_State* L);
 
+#if defined(__SWITCH__)
+    int DrawInstanced(lua_State* L);
+#endif
+
     int Ellipse(lua_State* L);
 
     int Line(lua_State* L);
@@ -97,6 +101,16 @@ namespace Wrap_Graphics
 
     int NewText(lua_State* L);
 
+    int NewSpriteBatch(lua_State* L);
+
+    int NewParticleSystem(lua_State* L);
+
+#if defined(__SWITCH__)
+    int NewMesh(lua_State* L);
+
+    int NewInstanceBuffer(lua_State* L);
+#endif
+
     int NewCanvas(lua_State* L);
 
     int NewVideo(lua_State* L);
@@ -117,6 +131,8 @@ namespace Wrap_Graphics
 
     int GetRendererInfo(lua_State* L);
 
+    int GetStats(lua_State* L);
+
     int GetBackgroundColor(lua_State* L);
 
     int GetCanvas(lua_State* L);
@@ -167,6 +183,14 @@ namespace Wrap_Graphics
 
     int SetWide(lua_State* L);
 
+    int GetStereoRecording(lua_State* L);
+
+    int SetStereoRecording(lua_State* L);
+
+    int GetStereoDepth(lua_State* L);
+
+    int SetStereoDepth(lua_State* L);
+
     /* End Nintendo 3DS */
 
     int Register(lua_State* L);
@@ -16,6 +16,12 @@ namespace love
 
     int EnableAccelerometerAsJoystick(lua_State* L);
 
+#if defined(__SWITCH__)
+    int SetVertexBufferSize(lua_State* L);
+
+    int SetBufferCount(lua_State* L);
+#endif
+
     int IsVersionCompatible(lua_State* L);
 
     /* Debugging Utility */
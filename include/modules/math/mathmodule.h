@@ -9,7 +9,7 @@
 #include "noise1234/noise1234.h"
 #include "noise1234/simplexnoise1234.h"
 
-#include <list>
+#include <span>
 #include <vector>
 
 namespace love
@@ -67,20 +67,29 @@ namespace love
 
         std::vector<Triangle> Triangulate(const std::vector<Vector2>& polygon);
 
-        bool IsConvex(const std::vector<Vector2>& polygon);
+        /*
+        ** Ear clipping over vertex indices: three per triangle go
+        ** into @triangles. Returns false when @polygon can't be
+        ** triangulated. Only reflex corners are tested against ears
+        */
+        static bool Triangulate(std::span<const Vector2> polygon,
+                                std::vector<uint32_t>& triangles);
+
+        static bool IsConvex(std::span<const Vector2> polygon);
 
       private:
         RandomGenerator rng;
 
         /* Helper Functions */
 
-        inline bool IsCounterClockwise(const Vector2& a, const Vector2& b, const Vector2& c)
+        static inline bool IsCounterClockwise(const Vector2& a, const Vector2& b,
+                                              const Vector2& c)
         {
             return ((b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x)) >= 0;
         }
 
-        inline bool OnSameSide(const Vector2& a, const Vector2& b, const Vector2& c,
-                               const Vector2& d)
+        static inline bool OnSameSide(const Vector2& a, const Vector2& b, const Vector2& c,
+                                      const Vector2& d)
         {
             float px = d.x - c.x, py = d.y - c.y;
 
@@ -91,29 +100,31 @@ namespace love
             return l * m >= 0;
         }
 
-        inline bool PointInTriangle(const Vector2& p, const Vector2& a, const Vector2& b,
-                                    const Vector2& c)
+        static inline bool PointInTriangle(const Vector2& p, const Vector2& a, const Vector2& b,
+                                           const Vector2& c)
         {
             return OnSameSide(p, a, b, c) && OnSameSide(p, b, a, c) && OnSameSide(p, c, a, b);
         }
 
-        inline bool AnyPointInTriangle(const std::list<const Vector2*>& vertices, const Vector2& a,
-                                       const Vector2& b, const Vector2& c)
+        static inline bool AnyPointInTriangle(std::span<const Vector2> polygon,
+                                              const std::vector<uint32_t>& vertices, uint32_t a,
+                                              uint32_t b, uint32_t c)
         {
-            for (const Vector2* p : vertices)
+            for (uint32_t p : vertices)
             {
-                if ((p != &a) && (p != &b) && (p != &c) &&
-                    PointInTriangle(*p, a, b, c)) // oh god...
+                if ((p != a) && (p != b) && (p != c) &&
+                    PointInTriangle(polygon[p], polygon[a], polygon[b], polygon[c]))
                     return true;
             }
 
             return false;
         }
 
-        inline bool IsEar(const Vector2& a, const Vector2& b, const Vector2& c,
-                          const std::list<const Vector2*>& vertices)
+        static inline bool IsEar(std::span<const Vector2> polygon, uint32_t a, uint32_t b,
+                                 uint32_t c, const std::vector<uint32_t>& vertices)
         {
-            return IsCounterClockwise(a, b, c) && !AnyPointInTriangle(vertices, a, b, c);
+            return IsCounterClockwise(polygon[a], polygon[b], polygon[c]) &&
+                   !AnyPointInTriangle(polygon, vertices, a, b, c);
         }
     };
 } // namespace love
@@ -27,6 +27,8 @@ namespace love
 
             Canvas(const Settings& settings);
 
+            virtual ~Canvas();
+
             virtual void Draw(Graphics* gfx, love::Quad* quad, const Matrix4& localTransform) = 0;
 
             bool HasFirstClear()
@@ -34,6 +36,8 @@ namespace love
                 return this->cleared;
             }
 
+            static int canvasCount;
+
           protected:
             Settings settings;
             bool cleared;
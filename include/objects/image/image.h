@@ -7,6 +7,12 @@
 #include "objects/compressedimagedata/compressedimagedata.h"
 #include "objects/imagedata/imagedata.h"
 
+#if defined(__3DS__)
+    #include "citro2d/residency.h"
+
+    #include <memory>
+#endif
+
 namespace love
 {
     class Image : public Texture
@@ -21,6 +27,11 @@ namespace love
             MIPMAPS_GENERATED,
         };
 
+        struct Settings
+        {
+            bool mipmaps = false;
+        };
+
         struct Slices
         {
           public:
@@ -53,6 +64,9 @@ namespace love
 
         void ReplacePixels(const void* data, size_t size, const Rect& rect);
 
+        /* Rebuilds the mip chain of an Image created with mipmaps = true */
+        void GenerateMipmaps();
+
         ~Image();
 
         Image(TextureType type, PixelFormat format, int width, int height, int slices);
@@ -61,9 +75,20 @@ namespace love
 
         void Init(PixelFormat format, int width, int height);
 
-        Image(const Slices& data);
+        Image(const Slices& data, const Settings& settings = Settings());
+
+        static int imageCount;
+
+#if defined(__3DS__)
+        /* Frees the texels in linear memory, keeping what it takes to restore them */
+        void Evict();
+#endif
 
       protected:
+#if defined(__3DS__)
+        void MakeResident() override;
+#endif
+
         PixelFormat format;
         Slices data;
         MipmapsType mipmapsType;
@@ -73,5 +98,18 @@ namespace love
         Image(const Slices& data, bool validate);
 
         TextureType textureType;
+
+#if defined(__3DS__)
+        void AllocateTexture();
+
+        void Upload();
+
+        TextureResidency::Handle residency;
+        bool resident = false;
+
+        /* texels were replaced, so the source data is out of date */
+        bool dirty = false;
+        std::unique_ptr<uint8_t[]> snapshot;
+#endif
     };
 } // namespace love
@@ -7,6 +7,8 @@
 
 namespace Wrap_Image
 {
+    int GenerateMipmaps(lua_State* L);
+
     int GetDimensions(lua_State* L);
 
     int GetFilter(lua_State* L);
@@ -0,0 +1,262 @@
+#pragma once
+
+#include "common/colors.h"
+#include "common/strongref.h"
+#include "common/vector.h"
+
+#include "objects/drawable/drawable.h"
+#include "objects/random/randomgenerator.h"
+#include "objects/texture/texture.h"
+
+#include <array>
+#include <vector>
+
+namespace love
+{
+    class Graphics;
+
+    namespace common
+    {
+        class ParticleSystem : public Drawable
+        {
+          public:
+            enum AreaSpreadDistribution
+            {
+                DISTRIBUTION_NONE,
+                DISTRIBUTION_UNIFORM,
+                DISTRIBUTION_NORMAL,
+                DISTRIBUTION_MAX_ENUM
+            };
+
+            static love::Type type;
+
+            static constexpr uint32_t MAX_PARTICLES = 0x100000;
+
+            static constexpr size_t MAX_SIZES  = 8;
+            static constexpr size_t MAX_COLORS = 8;
+
+            ParticleSystem(love::Texture* texture, uint32_t size);
+
+            virtual ~ParticleSystem();
+
+            void SetTexture(love::Texture* texture);
+
+            love::Texture* GetTexture() const;
+
+            void SetBufferSize(uint32_t size);
+
+            uint32_t GetBufferSize() const;
+
+            void SetEmissionRate(float rate);
+
+            float GetEmissionRate() const;
+
+            void SetEmitterLifetime(float lifetime);
+
+            float GetEmitterLifetime() const;
+
+            void SetParticleLifetime(float min, float max);
+
+            void GetParticleLifetime(float& min, float& max) const;
+
+            void SetPosition(float x, float y);
+
+            const Vector2& GetPosition() const;
+
+            void MoveTo(float x, float y);
+
+            void SetEmissionArea(AreaSpreadDistribution distribution, float x, float y,
+                                 float angle, bool directionRelativeToCenter);
+
+            AreaSpreadDistribution GetEmissionArea(Vector2& params, float& angle,
+                                                   bool& directionRelativeToCenter) const;
+
+            void SetDirection(float direction);
+
+            float GetDirection() const;
+
+            void SetSpread(float spread);
+
+            float GetSpread() const;
+
+            void SetSpeed(float min, float max);
+
+            void GetSpeed(float& min, float& max) const;
+
+            void SetLinearAcceleration(float xmin, float ymin, float xmax, float ymax);
+
+            void GetLinearAcceleration(Vector2& min, Vector2& max) const;
+
+            void SetRadialAcceleration(float min, float max);
+
+            void GetRadialAcceleration(float& min, float& max) const;
+
+            void SetTangentialAcceleration(float min, float max);
+
+            void GetTangentialAcceleration(float& min, float& max) const;
+
+            void SetLinearDamping(float min, float max);
+
+            void GetLinearDamping(float& min, float& max) const;
+
+            void SetSizes(const std::vector<float>& sizes);
+
+            const std::vector<float>& GetSizes() const;
+
+            void SetSizeVariation(float variation);
+
+            float GetSizeVariation() const;
+
+            void SetRotation(float min, float max);
+
+            void GetRotation(float& min, float& max) const;
+
+            void SetSpin(float start, float end);
+
+            void GetSpin(float& start, float& end) const;
+
+            void SetSpinVariation(float variation);
+
+            float GetSpinVariation() const;
+
+            void SetOffset(float x, float y);
+
+            const Vector2& GetOffset() const;
+
+            void SetColors(const std::vector<Colorf>& colors);
+
+            const std::vector<Colorf>& GetColors() const;
+
+            void SetRelativeRotation(bool enable);
+
+            bool HasRelativeRotation() const;
+
+            uint32_t GetCount() const;
+
+            void Start();
+
+            void Stop();
+
+            void Pause();
+
+            void Reset();
+
+            void Emit(uint32_t count);
+
+            bool IsActive() const;
+
+            bool IsPaused() const;
+
+            bool IsStopped() const;
+
+            bool IsEmpty() const;
+
+            bool IsFull() const;
+
+            void Update(float dt);
+
+            virtual void Draw(Graphics* gfx, const Matrix4& localTransform) = 0;
+
+            static bool GetConstant(const char* in, AreaSpreadDistribution& out);
+            static bool GetConstant(AreaSpreadDistribution in, const char*& out);
+            static std::vector<const char*> GetConstants(AreaSpreadDistribution);
+
+          protected:
+            /*
+            ** Particle state is kept as structure-of-arrays so
+            ** the update loop touches contiguous floats only
+            ** Live particles are always [0, activeCount)
+            */
+            struct
+            {
+                std::vector<float> x, y;
+                std::vector<float> originX, originY;
+                std::vector<float> velocityX, velocityY;
+                std::vector<float> accelerationX, accelerationY;
+                std::vector<float> radial, tangential;
+                std::vector<float> damping;
+                std::vector<float> life, lifetime;
+                std::vector<float> rotation, angle;
+                std::vector<float> spinStart, spinEnd;
+                std::vector<float> sizeOffset, sizeInterval;
+                std::vector<float> size;
+                std::vector<float> r, g, b, a;
+            } particles;
+
+            StrongReference<love::Texture> texture;
+
+            uint32_t maxParticles;
+            uint32_t activeCount;
+
+            bool active;
+            bool paused;
+
+            float emissionRate;
+            float emitCounter;
+
+            Vector2 position;
+            Vector2 prevPosition;
+
+            AreaSpreadDistribution emissionAreaDistribution;
+            Vector2 emissionArea;
+            float emissionAreaAngle;
+            bool directionRelativeToEmissionCenter;
+
+            float lifetime;
+            float life;
+
+            float particleLifeMin;
+            float particleLifeMax;
+
+            float direction;
+            float spread;
+
+            float speedMin;
+            float speedMax;
+
+            Vector2 linearAccelerationMin;
+            Vector2 linearAccelerationMax;
+
+            float radialAccelerationMin;
+            float radialAccelerationMax;
+
+            float tangentialAccelerationMin;
+            float tangentialAccelerationMax;
+
+            float linearDampingMin;
+            float linearDampingMax;
+
+            std::vector<float> sizes;
+            float sizeVariation;
+
+            float rotationMin;
+            float rotationMax;
+
+            float spinStart;
+            float spinEnd;
+            float spinVariation;
+
+            Vector2 offset;
+
+            std::vector<Colorf> colors;
+
+            bool relativeRotation;
+
+            RandomGenerator rng;
+
+          private:
+            static constexpr size_t CHANNEL_COUNT = 24;
+
+            using Channels = std::array<std::vector<float>*, CHANNEL_COUNT>;
+
+            /* Every per-particle array, for resizing and moving particles */
+            Channels GetChannels();
+
+            void AddParticle(float t);
+
+            void RemoveParticle(uint32_t index);
+
+            void Simulate(float dt);
+        };
+    } // namespace common
+} // namespace love
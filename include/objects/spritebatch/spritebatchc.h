@@ -0,0 +1,91 @@
+#pragma once
+
+#include "common/colors.h"
+#include "common/exception.h"
+#include "common/strongref.h"
+#include "common/vertexc.h"
+
+#include "objects/drawable/drawable.h"
+#include "objects/quad/quad.h"
+#include "objects/texture/texture.h"
+
+namespace love
+{
+    class Graphics;
+
+    namespace common
+    {
+        class SpriteBatch : public Drawable
+        {
+          public:
+            static love::Type type;
+
+            static constexpr int DEFAULT_SIZE = 1000;
+
+            SpriteBatch(love::Texture* texture, int size, vertex::Usage usage);
+
+            virtual ~SpriteBatch();
+
+            int Add(const Matrix4& transform, int index = -1);
+
+            virtual int Add(love::Quad* quad, const Matrix4& transform, int index = -1) = 0;
+
+            virtual void Clear();
+
+            virtual void Flush() = 0;
+
+            virtual void SetTexture(love::Texture* texture);
+
+            love::Texture* GetTexture() const;
+
+            /*
+            ** Color applied to sprites added after this call
+            ** Sprites already in the batch keep theirs
+            */
+            void SetColor(const Colorf& color);
+
+            void SetColor();
+
+            Colorf GetColor(bool& active) const;
+
+            int GetCount() const;
+
+            int GetBufferSize() const;
+
+            vertex::Usage GetUsage() const;
+
+            void SetDrawRange(int start, int count);
+
+            void SetDrawRange();
+
+            bool GetDrawRange(int& start, int& count) const;
+
+            virtual void Draw(Graphics* gfx, const Matrix4& localTransform) = 0;
+
+          protected:
+            StrongReference<love::Texture> texture;
+
+            int size;
+            int next;
+
+            Colorf color;
+            bool colorActive;
+
+            vertex::Usage usage;
+
+            int rangeStart;
+            int rangeCount;
+
+            /*
+            ** Resolves the sprite index an add/set call writes to
+            ** growing the batch when needed
+            */
+            int GetAddIndex(int index);
+
+            /* Get the sprites [start, start + count) to draw */
+            void GetDrawSpan(int& start, int& count) const;
+
+            virtual void SetBufferSize(int newSize) = 0;
+        };
+    } // namespace common
+} // namespace love
@@ -63,6 +63,8 @@ namespace love::common
         static FilterMode defaultMipmapFilter;
         static float defaultMipmapSharpness;
 
+        static int64_t totalGraphicsMemory;
+
         Texture(TextureType texType);
         virtual ~Texture();
 
@@ -115,6 +117,10 @@ namespace love::common
 
         StrongReference<love::Quad> quad;
 
+        int64_t graphicsMemorySize;
+
         void InitQuad();
+
+        void SetGraphicsMemorySize(int64_t bytes);
     };
 } // namespace love::common
@@ -12,6 +12,8 @@ namespace Wrap_Texture
 
     int GetDimensions(lua_State* L);
 
+    int GetMipmapCount(lua_State* L);
+
     int SetFilter(lua_State* L);
 
     int GetFilter(lua_State* L);
@@ -20,7 +22,7 @@ namespace Wrap_Texture
 
     int GetWrap(lua_State* L);
 
-    extern const luaL_Reg functions[9];
+    extern const luaL_Reg functions[10];
 
     love::Texture* CheckTexture(lua_State* L, int index);
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/lmath.h"
+#include "common/matrix.h"
 #include "objects/canvas/canvas.h"
 
 #include <citro2d.h>
@@ -8,6 +9,10 @@
 #include "common/pixelformat.h"
 #include "graphics/graphics.h"
 #include <functional>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
 
 class citro2d
 {
@@ -99,12 +104,108 @@ class citro2d
 
     static bool GetConstant(GPU_TEXCOLOR in, love::PixelFormat& out);
 
+    /*
+    ** Account for @vertices vertices drawn from @texture, or
+    ** nullptr for solid shapes. citro2d keeps appending them
+    ** to one draw until the texture changes or it is flushed
+    */
+    void CountDraw(const C3D_Tex* texture, size_t vertices);
+
+    /* Text can span several glyph sheets, count it as its own draw */
+    void CountText(const C2D_Text& text);
+
+    void FlushBatch();
+
+    /* Fills in the renderer counters of @stats */
+    void GetStats(love::Graphics::Stats& stats) const;
+
+    /*
+    ** Stereo recording: with 3D enabled, what is drawn to the left
+    ** eye is kept in a display list instead. Once the top screen is
+    ** left (or on Present) the list is replayed into both eyes,
+    ** each draw shifted by its stereo depth times the 3D slider
+    */
+    void SetStereoRecording(bool enable)
+    {
+        this->stereo.enabled = enable;
+    }
+
+    bool GetStereoRecording() const
+    {
+        return this->stereo.enabled;
+    }
+
+    /* Parallax in pixels at full slider, positive goes into the screen */
+    void SetStereoDepth(float depth)
+    {
+        this->stereo.depth = depth;
+    }
+
+    float GetStereoDepth() const
+    {
+        return this->stereo.depth;
+    }
+
+    /*
+    ** Runs @draw now, or appends it to the display list when
+    ** recording. Only recorded draws are type-erased
+    */
+    template<typename F>
+    void Submit(F&& draw)
+    {
+        if (this->IsRecording())
+        {
+            this->stereo.commands.push_back({ this->stereo.depth, std::forward<F>(draw) });
+            return;
+        }
+
+        this->stereo.drawDepth = this->stereo.depth;
+        draw();
+    }
+
+    /*
+    ** Like Submit, for draws that read @arrays owned by the caller
+    ** @draw gets them as spans of the caller's memory, unless
+    ** recording, where the draw keeps copies of its own
+    */
+    template<typename F, typename... T>
+    void SubmitArrays(F&& draw, std::span<const T>... arrays)
+    {
+        if (this->IsRecording())
+        {
+            auto command = [draw = std::forward<F>(draw),
+                            ... copies = std::vector<T>(arrays.begin(), arrays.end())]() mutable {
+                draw(std::span<const T>(copies)...);
+            };
+
+            this->stereo.commands.push_back({ this->stereo.depth, std::move(command) });
+            return;
+        }
+
+        this->stereo.drawDepth = this->stereo.depth;
+        draw(arrays...);
+    }
+
+    /* Like Submit, but state changes also apply now for any canvas drawn in between */
+    template<typename F>
+    void SubmitState(F&& state)
+    {
+        this->stereo.drawDepth = this->stereo.depth;
+        state();
+
+        if (this->stereo.recording)
+            this->stereo.commands.push_back({ this->stereo.depth, std::forward<F>(state) });
+    }
+
+    /* C2D_ViewRestore with the parallax of the eye being drawn */
+    void SetView(const love::Matrix4& transform);
+
   private:
     GPUFilter filter;
 
     std::vector<std::function<void()>> deferredFunctions;
     std::vector<C3D_RenderTarget*> targets;
-    C3D_RenderTarget* current;
+    C3D_RenderTarget* current = nullptr;
 
     struct
     {
@@ -114,5 +215,91 @@ class citro2d
 
     bool inFrame = false;
 
+    struct DrawCommand
+    {
+        float depth;
+        std::function<void()> draw;
+    };
+
+    struct
+    {
+        bool enabled   = false;
+        bool recording = false;
+
+        float depth     = 0.0f;
+        float drawDepth = 0.0f;
+        float eye       = 0.0f;
+
+        std::vector<DrawCommand> commands;
+    } stereo;
+
+    struct
+    {
+        const C3D_Tex* texture = nullptr;
+        bool open              = false;
+    } batch;
+
+    struct BlendState
+    {
+        GPU_BLENDEQUATION func;
+        GPU_BLENDFACTOR srcColor;
+        GPU_BLENDFACTOR srcAlpha;
+        GPU_BLENDFACTOR dstColor;
+        GPU_BLENDFACTOR dstAlpha;
+
+        bool operator==(const BlendState&) const = default;
+    };
+
+    struct ScissorState
+    {
+        GPU_SCISSORMODE mode;
+        uint32_t left;
+        uint32_t top;
+        uint32_t right;
+        uint32_t bottom;
+
+        bool operator==(const ScissorState&) const = default;
+    };
+
+    /*
+    ** GPU state as it was last set, so setting it again
+    ** doesn't flush the batch. Unset until first applied
+    */
+    struct
+    {
+        std::optional<BlendState> blend;
+        std::optional<uint8_t> writeMask;
+        std::optional<ScissorState> scissor;
+    } bound;
+
+    struct
+    {
+        int drawCalls        = 0;
+        int drawCallsBatched = 0;
+        int canvasSwitches   = 0;
+        int textureBinds     = 0;
+        int vertices         = 0;
+        int skippedBinds     = 0;
+        int flushes          = 0;
+
+        int vertexHighWater     = 0;
+        size_t commandHighWater = 0;
+    } stats;
+
     void EnsureInFrame();
+
+    bool IsRecording() const
+    {
+        return this->stereo.recording && this->current == this->targets[GFX_LEFT];
+    }
+
+    void BeginStereo();
+
+    void ReplayStereo();
+
+    void ApplyBlendMode(const BlendState& blend);
+
+    void ApplyColorMask(uint8_t writeMask);
+
+    void ApplyScissor(const ScissorState& scissor);
 };
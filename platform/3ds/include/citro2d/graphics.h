@@ -19,6 +19,8 @@ namespace love::citro2d
 
         RendererInfo GetRendererInfo() const override;
 
+        Stats GetStats() const override;
+
         void Clear(std::optional<Colorf> color, std::optional<int> stencil,
                    std::optional<double> depth) override;
 
@@ -98,6 +100,14 @@ namespace love::citro2d
         void SetWide(bool enable);
 
         const bool GetWide() const;
+
+        void SetStereoRecording(bool enable);
+
+        bool GetStereoRecording() const;
+
+        void SetStereoDepth(float depth);
+
+        float GetStereoDepth() const;
         /* End Nintendo 3DS */
 
         /* Useless */
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+
+namespace love
+{
+    class Image;
+}
+
+/*
+** Keeps the Images whose texels live in linear memory, most
+** recently drawn first. When an allocation fails, the least
+** recently drawn one is evicted and the Image brings itself
+** back the next time it is drawn
+*/
+class TextureResidency
+{
+  public:
+    struct Entry
+    {
+        love::Image* image;
+        size_t bytes;
+        uint64_t lastFrame;
+    };
+
+    using Handle = std::list<Entry>::iterator;
+
+    /* Kept for the whole run, not per frame */
+    struct Stats
+    {
+        int evictions         = 0;
+        int restores          = 0;
+        int64_t evictedMemory = 0;
+    };
+
+    static TextureResidency& Instance();
+
+    /* @image now holds @bytes of linear memory */
+    Handle Track(love::Image* image, size_t bytes);
+
+    void Untrack(Handle handle);
+
+    /* @handle's Image is drawn this frame */
+    void Touch(Handle handle);
+
+    /*
+    ** Evicts the least recently drawn Image, if it was not drawn
+    ** this frame or the one before, which the GPU may still read
+    */
+    bool EvictLeastRecent();
+
+    /* An evicted Image of @bytes is back in linear memory */
+    void Restored(size_t bytes);
+
+    /* An evicted Image of @bytes was destroyed without coming back */
+    void Dropped(size_t bytes);
+
+    void EndFrame();
+
+    const Stats& GetStats() const
+    {
+        return this->stats;
+    }
+
+  private:
+    TextureResidency() : frame(0)
+    {}
+
+    std::list<Entry> resident;
+    uint64_t frame;
+
+    Stats stats;
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+/*
+** Copy kernels for the 3DS texture layout: 8x8 tiles laid out
+** row by row, with the texels of a tile stored in Morton order
+** Texels are moved as raw values of type T, never unpacked
+*/
+namespace love::tiling
+{
+    static constexpr unsigned TILE_SIZE   = 8;
+    static constexpr unsigned TILE_TEXELS = TILE_SIZE * TILE_SIZE;
+
+    // clang-format off
+    /* Morton offset of a texel inside its tile, indexed by y * 8 + x */
+    inline constexpr uint8_t MORTON[TILE_TEXELS] =
+    {
+         0,  1,  4,  5, 16, 17, 20, 21,
+         2,  3,  6,  7, 18, 19, 22, 23,
+         8,  9, 12, 13, 24, 25, 28, 29,
+        10, 11, 14, 15, 26, 27, 30, 31,
+        32, 33, 36, 37, 48, 49, 52, 53,
+        34, 35, 38, 39, 50, 51, 54, 55,
+        40, 41, 44, 45, 56, 57, 60, 61,
+        42, 43, 46, 47, 58, 59, 62, 63,
+    };
+    // clang-format on
+
+    /* Index of the first texel of the tile holding (@x, @y) */
+    inline unsigned TileOffset(unsigned width, unsigned x, unsigned y)
+    {
+        return ((width / TILE_SIZE) * (y / TILE_SIZE) + (x / TILE_SIZE)) * TILE_TEXELS;
+    }
+
+    /* Texel by texel, looking up the row of the Morton table once per row */
+    template<typename T>
+    void CopyTexels(const T* src, unsigned srcWidth, unsigned sx, unsigned sy, T* dst,
+                    unsigned dstWidth, unsigned dx, unsigned dy, unsigned width, unsigned height)
+    {
+        for (unsigned y = 0; y < height; y++)
+        {
+            const T* srcRow = src + TileOffset(srcWidth, 0, sy + y);
+            T* dstRow       = dst + TileOffset(dstWidth, 0, dy + y);
+
+            const uint8_t* srcMorton = MORTON + ((sy + y) % TILE_SIZE) * TILE_SIZE;
+            const uint8_t* dstMorton = MORTON + ((dy + y) % TILE_SIZE) * TILE_SIZE;
+
+            for (unsigned x = 0; x < width; x++)
+            {
+                unsigned srcX = sx + x;
+                unsigned dstX = dx + x;
+
+                dstRow[(dstX / TILE_SIZE) * TILE_TEXELS + dstMorton[dstX % TILE_SIZE]] =
+                    srcRow[(srcX / TILE_SIZE) * TILE_TEXELS + srcMorton[srcX % TILE_SIZE]];
+            }
+        }
+    }
+
+    /*
+    ** Copies a @width by @height block from (@sx, @sy) of @src to
+    ** (@dx, @dy) of @dst. Both are tiled, @srcWidth and @dstWidth
+    ** texels wide. When both corners sit on a tile boundary, whole
+    ** tiles are copied in one go and only the edges go texel by texel
+    */
+    template<typename T>
+    void CopyTiled(const T* src, unsigned srcWidth, unsigned sx, unsigned sy, T* dst,
+                   unsigned dstWidth, unsigned dx, unsigned dy, unsigned width, unsigned height)
+    {
+        if (((sx | sy | dx | dy) % TILE_SIZE) != 0)
+        {
+            CopyTexels(src, srcWidth, sx, sy, dst, dstWidth, dx, dy, width, height);
+            return;
+        }
+
+        unsigned tiledWidth  = width - (width % TILE_SIZE);
+        unsigned tiledHeight = height - (height % TILE_SIZE);
+
+        for (unsigned y = 0; y < tiledHeight; y += TILE_SIZE)
+        {
+            for (unsigned x = 0; x < tiledWidth; x += TILE_SIZE)
+            {
+                std::memcpy(dst + TileOffset(dstWidth, dx + x, dy + y),
+                            src + TileOffset(srcWidth, sx + x, sy + y), TILE_TEXELS * sizeof(T));
+            }
+        }
+
+        /* the partial column on the right, then the partial row at the bottom */
+        CopyTexels(src, srcWidth, sx + tiledWidth, sy, dst, dstWidth, dx + tiledWidth, dy,
+                   width - tiledWidth, tiledHeight);
+
+        CopyTexels(src, srcWidth, sx, sy + tiledHeight, dst, dstWidth, dx, dy + tiledHeight,
+                   width, height - tiledHeight);
+    }
+} // namespace love::tiling
@@ -8,6 +8,9 @@
 
 #include "objects/bcfntrasterizer/bcfntrasterizer.h"
 
+#include <list>
+#include <unordered_map>
+
 enum class love::common::Font::SystemFontType : uint8_t
 {
     TYPE_STANDARD  = CFG_REGION_USA,
@@ -24,6 +27,9 @@ namespace love
       public:
         static constexpr int FONT_BUFFER_SIZE = 0x200;
 
+        /* Glyphs kept by the layout cache, shared between its strings */
+        static constexpr size_t TEXT_CACHE_GLYPHS = 0x1000;
+
         Font(Rasterizer* r, const Texture::Filter& filter);
 
         virtual ~Font();
@@ -70,9 +76,30 @@ namespace love
         float GetScale() const;
 
       private:
+        /*
+        ** A parsed string, with a buffer of its own so it
+        ** can be dropped without touching the other ones
+        */
+        struct CachedText
+        {
+            std::string string;
+            C2D_TextBuf buffer;
+            C2D_Text text;
+            size_t glyphs;
+        };
+
+        const C2D_Text* ParseText(const std::string& string, C2D_Text& scratch);
+
+        void EvictText();
+
         StrongReference<Rasterizer> rasterizer;
         C2D_TextBuf buffer;
 
+        /* most recently drawn first */
+        std::list<CachedText> textCache;
+        std::unordered_map<std::string, std::list<CachedText>::iterator> textLookup;
+        size_t cachedGlyphs;
+
         std::unordered_map<uint32_t, float> glyphWidths;
     };
 } // namespace love
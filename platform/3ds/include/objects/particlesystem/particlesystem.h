@@ -0,0 +1,22 @@
+#pragma once
+
+#include "objects/particlesystem/particlesystemc.h"
+#include <citro2d.h>
+
+namespace love
+{
+    class ParticleSystem : public common::ParticleSystem
+    {
+      public:
+        ParticleSystem(Texture* texture, uint32_t size);
+
+        virtual ~ParticleSystem()
+        {}
+
+        void Draw(Graphics* gfx, const Matrix4& localTransform) override;
+
+      private:
+        /* The particles resolved by the last Draw, kept to reuse the memory */
+        std::vector<std::pair<C2D_DrawParams, C2D_ImageTint>> draws;
+    };
+} // namespace love
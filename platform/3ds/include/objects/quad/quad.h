@@ -18,6 +18,9 @@ namespace love
         const Tex3DS_SubTexture& CalculateTex3DSViewport(const Viewport& viewport,
                                                          C3D_Tex* texture);
 
+        /* @viewport of @texture, without keeping it around */
+        static Tex3DS_SubTexture GetTex3DSViewport(const Viewport& viewport, C3D_Tex* texture);
+
       private:
         Tex3DS_SubTexture subTex;
     };
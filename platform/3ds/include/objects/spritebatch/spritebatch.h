@@ -0,0 +1,43 @@
+#pragma once
+
+#include "objects/spritebatch/spritebatchc.h"
+#include <citro2d.h>
+
+namespace love
+{
+    class SpriteBatch : public common::SpriteBatch
+    {
+      public:
+        SpriteBatch(Texture* texture, int size, vertex::Usage usage);
+
+        virtual ~SpriteBatch()
+        {}
+
+        int Add(Quad* quad, const Matrix4& transform, int index = -1) override;
+
+        void Flush() override;
+
+        void SetTexture(love::Texture* texture) override;
+
+        void Draw(Graphics* gfx, const Matrix4& localTransform) override;
+
+      private:
+        /*
+        ** citro2d does not let us hand it our own vertices,
+        ** so everything C2D_DrawImage needs is built once
+        ** on add and only submitted on draw. The viewport is
+        ** kept to build the subtexture again for a new texture
+        */
+        struct Sprite
+        {
+            Quad::Viewport viewport;
+            Tex3DS_SubTexture subTexture;
+            Matrix4 transform;
+            C2D_ImageTint tint;
+        };
+
+        std::vector<Sprite> sprites;
+
+        void SetBufferSize(int newSize) override;
+    };
+} // namespace love
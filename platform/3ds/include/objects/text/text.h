@@ -2,6 +2,8 @@
 
 #include "objects/text/textc.h"
 
+#include <memory>
+
 namespace love
 {
     class Text : public common::Text
@@ -37,12 +39,28 @@ namespace love
       private:
         std::vector<std::pair<float, Font::AlignMode>> wrapData;
 
-        C2D_TextBuf buffer;
-        C2D_Text text;
+        /* Parsed glyphs, shared with recorded draws that still have to replay them */
+        struct Layout
+        {
+            C2D_TextBuf buffer;
+            C2D_Text text;
+
+            Layout() : buffer(C2D_TextBufNew(Font::FONT_BUFFER_SIZE)), text {}
+            {}
+
+            ~Layout()
+            {
+                C2D_TextBufDelete(this->buffer);
+            }
+        };
+
+        std::shared_ptr<Layout> layout;
 
         std::string textCache;
 
         float wrap;
         Font::AlignMode align;
+
+        void Parse();
     };
 } // namespace love
\ No newline at end of file
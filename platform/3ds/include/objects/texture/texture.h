@@ -24,6 +24,10 @@ namespace love
         void SetFilter(const Filter& filter) override;
 
       protected:
+        /* Called before the handle is used for drawing */
+        virtual void MakeResident()
+        {}
+
         C2D_Image texture;
         C2D_SpriteSheet sheet;
     };
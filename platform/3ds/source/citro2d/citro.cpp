@@ -5,14 +5,22 @@
 #include "common/luax.h"
 
 #include "citro2d/citro.h"
+#include "citro2d/residency.h"
 
 #include "common/bidirectionalmap.h"
 #include "modules/graphics/graphics.h"
 
 #include "common/pixelformat.h"
 
+#include <algorithm>
+
 using namespace love;
 
+/* Set up by libctru at boot, the size of the heap linearAlloc hands out */
+extern "C" u32 __ctru_linear_heap_size;
+
+#define VRAM_SIZE 0x600000
+
 citro2d::citro2d()
 {
     gfxInitDefault();
@@ -73,18 +81,45 @@ void citro2d::SetBlendMode(GPU_BLENDEQUATION func, GPU_BLENDFACTOR srcColor,
                            GPU_BLENDFACTOR srcAlpha, GPU_BLENDFACTOR dstColor,
                            GPU_BLENDFACTOR dstAlpha)
 {
-    C2D_Flush();
-    C3D_AlphaBlend(func, func, srcColor, dstColor, srcAlpha, dstAlpha);
+    const BlendState blend { func, srcColor, srcAlpha, dstColor, dstAlpha };
+    this->SubmitState([this, blend]() { this->ApplyBlendMode(blend); });
 }
 
-void citro2d::SetColorMask(const love::Graphics::ColorMask& mask)
+void citro2d::ApplyBlendMode(const BlendState& blend)
 {
-    C2D_Flush();
+    if (this->bound.blend == blend)
+    {
+        this->stats.skippedBinds++;
+        return;
+    }
+
+    this->FlushBatch();
+    C3D_AlphaBlend(blend.func, blend.func, blend.srcColor, blend.dstColor, blend.srcAlpha,
+                   blend.dstAlpha);
 
+    this->bound.blend = blend;
+}
+
+void citro2d::SetColorMask(const love::Graphics::ColorMask& mask)
+{
     uint8_t writeMask = GPU_WRITE_DEPTH;
     writeMask |= mask.GetColorMask();
 
+    this->SubmitState([this, writeMask]() { this->ApplyColorMask(writeMask); });
+}
+
+void citro2d::ApplyColorMask(uint8_t writeMask)
+{
+    if (this->bound.writeMask == writeMask)
+    {
+        this->stats.skippedBinds++;
+        return;
+    }
+
+    this->FlushBatch();
     C3D_DepthTest(true, GPU_GEQUAL, static_cast<GPU_WRITEMASK>(writeMask));
+
+    this->bound.writeMask = writeMask;
 }
 
 void citro2d::EnsureInFrame()
@@ -100,27 +135,148 @@ void citro2d::BindFramebuffer(love::Canvas* canvas)
 {
     this->EnsureInFrame();
 
+    C3D_RenderTarget* target = nullptr;
+
     if (canvas != nullptr)
-        this->current = canvas->GetRenderer();
+        target = canvas->GetRenderer();
     else
-        this->current = this->targets[love::Graphics::ACTIVE_SCREEN];
+        target = this->targets[love::Graphics::ACTIVE_SCREEN];
 
+    /* canvases are drawn as they come, any other screen ends the recording */
+    if (this->stereo.recording && canvas == nullptr && target != this->targets[GFX_LEFT])
+        this->ReplayStereo();
+
+    this->current = target;
+
+    /* this flushes whatever was drawn to the previous target */
     C2D_SceneBegin(this->current);
+
+    this->batch.open = false;
+    this->stats.canvasSwitches++;
+    this->stats.flushes++;
+
+    /* the new target starts with its own viewport, so apply the scissor again */
+    this->bound.scissor.reset();
+
+    this->stereo.eye = 0.0f;
+
+    if (canvas != nullptr || !this->Get3D())
+        return;
+
+    if (target == this->targets[GFX_LEFT])
+    {
+        this->stereo.eye = -1.0f;
+
+        if (this->stereo.enabled && !this->stereo.recording)
+            this->BeginStereo();
+    }
+    else if (target == this->targets[GFX_RIGHT])
+        this->stereo.eye = 1.0f;
 }
 
 void citro2d::ClearColor(const Colorf& color)
 {
-    C2D_TargetClear(this->current, C2D_Color32f(color.r, color.g, color.b, color.a));
+    u32 clearColor = C2D_Color32f(color.r, color.g, color.b, color.a);
+    this->Submit([this, clearColor]() { C2D_TargetClear(this->current, clearColor); });
+}
+
+void citro2d::SetView(const love::Matrix4& transform)
+{
+    float shift = this->stereo.eye * this->stereo.drawDepth * osGet3DSliderState();
+
+    if (shift == 0.0f)
+    {
+        C2D_ViewRestore(&transform.GetElements());
+        return;
+    }
+
+    love::Matrix4 eye;
+    eye.Translate(shift, 0.0f);
+
+    love::Matrix4 view(eye, transform);
+    C2D_ViewRestore(&view.GetElements());
+}
+
+void citro2d::BeginStereo()
+{
+    this->stereo.commands.clear();
+    this->stereo.recording = true;
+
+    /* each eye starts out from the state bound right now */
+    if (this->bound.blend.has_value())
+    {
+        BlendState blend = this->bound.blend.value();
+        this->stereo.commands.push_back({ 0.0f, [this, blend]() { this->ApplyBlendMode(blend); } });
+    }
+
+    if (this->bound.writeMask.has_value())
+    {
+        uint8_t mask = this->bound.writeMask.value();
+        this->stereo.commands.push_back({ 0.0f, [this, mask]() { this->ApplyColorMask(mask); } });
+    }
+}
+
+void citro2d::ReplayStereo()
+{
+    this->stereo.recording = false;
+
+    const std::pair<gfx3dSide_t, float> eyes[] = { { GFX_LEFT, -1.0f }, { GFX_RIGHT, 1.0f } };
+
+    for (const auto& [side, eye] : eyes)
+    {
+        this->current = this->targets[side];
+        C2D_SceneBegin(this->current);
+
+        this->batch.open = false;
+        this->stats.canvasSwitches++;
+        this->stats.flushes++;
+
+        this->bound.blend.reset();
+        this->bound.writeMask.reset();
+        this->bound.scissor.reset();
+
+        this->stereo.eye = eye;
+
+        for (auto& command : this->stereo.commands)
+        {
+            this->stereo.drawDepth = command.depth;
+            command.draw();
+        }
+    }
+
+    this->stereo.commands.clear();
 }
 
 void citro2d::Present()
 {
     if (this->inFrame)
     {
+        if (this->stereo.recording)
+            this->ReplayStereo();
+
+        this->FlushBatch();
+
+        size_t commandBytes = C3D_GetCmdBufUsage() * C3D_DEFAULT_CMDBUF_SIZE;
+
+        this->stats.commandHighWater = std::max(this->stats.commandHighWater, commandBytes);
+        this->stats.vertexHighWater  = std::max(this->stats.vertexHighWater, this->stats.vertices);
+
         C3D_FrameEnd(0);
         this->inFrame = false;
     }
 
+    this->batch.open = false;
+
+    this->stats.drawCalls        = 0;
+    this->stats.drawCallsBatched = 0;
+    this->stats.canvasSwitches   = 0;
+    this->stats.textureBinds     = 0;
+    this->stats.vertices         = 0;
+    this->stats.skippedBinds     = 0;
+    this->stats.flushes          = 0;
+
+    TextureResidency::Instance().EndFrame();
+
     for (size_t i = this->deferredFunctions.size(); i > 0; i--)
     {
         this->deferredFunctions[i - 1]();
@@ -128,10 +284,70 @@ void citro2d::Present()
     }
 }
 
-void citro2d::SetScissor(GPU_SCISSORMODE mode, const love::Rect& scissor, bool canvasActive)
+void citro2d::FlushBatch()
 {
     C2D_Flush();
+    this->batch.open = false;
+
+    this->stats.flushes++;
+}
+
+void citro2d::CountDraw(const C3D_Tex* texture, size_t vertices)
+{
+    if (this->batch.open && this->batch.texture == texture)
+        this->stats.drawCallsBatched++;
+    else
+    {
+        this->stats.drawCalls++;
+
+        if (texture != nullptr)
+            this->stats.textureBinds++;
+
+        this->batch.texture = texture;
+        this->batch.open    = true;
+    }
+
+    this->stats.vertices += vertices;
+}
+
+void citro2d::CountText(const C2D_Text& text)
+{
+    this->stats.drawCalls++;
+    this->stats.textureBinds++;
+
+    /* every glyph is a quad of two triangles */
+    this->stats.vertices += (text.end - text.begin) * 6;
+
+    /* the glyph sheet bound last is unknown to us */
+    this->batch.open = false;
+}
 
+void citro2d::GetStats(love::Graphics::Stats& stats) const
+{
+    stats.drawCalls        = this->stats.drawCalls;
+    stats.drawCallsBatched = this->stats.drawCallsBatched;
+    stats.canvasSwitches   = this->stats.canvasSwitches;
+    stats.shaderSwitches   = 0;
+    stats.textureBinds     = this->stats.textureBinds;
+    stats.vertices         = this->stats.vertices;
+    stats.skippedBinds     = this->stats.skippedBinds;
+    stats.flushes          = this->stats.flushes;
+
+    stats.vertexHighWater  = this->stats.vertexHighWater;
+    stats.commandHighWater = this->stats.commandHighWater;
+
+    const auto& residency = TextureResidency::Instance().GetStats();
+
+    stats.evictions     = residency.evictions;
+    stats.restores      = residency.restores;
+    stats.evictedMemory = residency.evictedMemory;
+
+    stats.pools = { { "linear", __ctru_linear_heap_size - linearSpaceFree() },
+                    { "vram", VRAM_SIZE - vramSpaceFree() } };
+}
+
+void citro2d::SetScissor(GPU_SCISSORMODE mode, const love::Rect& scissor, bool canvasActive)
+{
     size_t width = Screen::Instance().GetWidth(Graphics::ACTIVE_SCREEN);
 
     uint32_t left   = 240 > (scissor.y + scissor.h) ? 240 - (scissor.y + scissor.h) : 0;
@@ -139,15 +355,32 @@ void citro2d::SetScissor(GPU_SCISSORMODE mode, const love::Rect& scissor, bool c
     uint32_t right  = 240 - scissor.y;
     uint32_t bottom = width - scissor.x;
 
-    C3D_SetScissor(mode, left, top, right, bottom);
+    const ScissorState state { mode, left, top, right, bottom };
+    this->SubmitState([this, state]() { this->ApplyScissor(state); });
+}
+
+void citro2d::ApplyScissor(const ScissorState& scissor)
+{
+    if (this->bound.scissor == scissor)
+    {
+        this->stats.skippedBinds++;
+        return;
+    }
+
+    this->FlushBatch();
+    C3D_SetScissor(scissor.mode, scissor.left, scissor.top, scissor.right, scissor.bottom);
+
+    this->bound.scissor = scissor;
 }
 
 void citro2d::SetStencil(GPU_TESTFUNC compare, int value)
 {
     bool enabled = (compare == GPU_ALWAYS) ? false : true;
 
-    C3D_StencilTest(enabled, compare, value, 0xFFFFFFFF, 0xFFFFFFFF);
-    C3D_StencilOp(GPU_STENCIL_KEEP, GPU_STENCIL_KEEP, GPU_STENCIL_KEEP);
+    this->SubmitState([enabled, compare, value]() {
+        C3D_StencilTest(enabled, compare, value, 0xFFFFFFFF, 0xFFFFFFFF);
+        C3D_StencilOp(GPU_STENCIL_KEEP, GPU_STENCIL_KEEP, GPU_STENCIL_KEEP);
+    });
 }
 
 // Set the global filter mode for textures
@@ -8,6 +8,9 @@ using namespace love;
 #define TRANSPARENCY       C2D_Color32(0, 0, 0, 1)
 #define TRANSPARENCY_DEBUG C2D_Color32(255, 0, 0, 96)
 
+/* citro2d emits rectangles, ellipses and lines as two triangles */
+#define QUAD_VERTEX_COUNT 6
+
 love::citro2d::Graphics::Graphics()
 {
     this->RestoreState(this->states.back());
@@ -115,6 +118,26 @@ const bool love::citro2d::Graphics::GetWide() const
     return ::citro2d::Instance().GetWide();
 }
 
+void love::citro2d::Graphics::SetStereoRecording(bool enable)
+{
+    ::citro2d::Instance().SetStereoRecording(enable);
+}
+
+bool love::citro2d::Graphics::GetStereoRecording() const
+{
+    return ::citro2d::Instance().GetStereoRecording();
+}
+
+void love::citro2d::Graphics::SetStereoDepth(float depth)
+{
+    ::citro2d::Instance().SetStereoDepth(depth);
+}
+
+float love::citro2d::Graphics::GetStereoDepth() const
+{
+    return ::citro2d::Instance().GetStereoDepth();
+}
+
 void love::citro2d::Graphics::Clear(std::optional<Colorf> color, std::optional<int> stencil,
                                     std::optional<double> depth)
 {
@@ -232,31 +255,44 @@ void love::citro2d::Graphics::SetPointSize(float size)
 void love::citro2d::Graphics::Points(const Vector2* points, size_t count, const Colorf* colors,
                                      size_t colorCount)
 {
-    const Matrix4& t = this->GetTransform();
-    C2D_ViewRestore(&t.GetElements());
-
-    for (size_t index = 0; index < count; index++)
-    {
-        Colorf color        = colors[0];
-        const Vector2 point = points[index];
-
-        if (index < colorCount)
-            color = colors[index];
-
-        u32 pointColor = C2D_Color32f(color.r, color.g, color.b, color.a);
-        C2D_DrawCircleSolid(point.x, point.y, Graphics::CURRENT_DEPTH,
-                            this->states.back().pointSize, pointColor);
-    }
+    ::citro2d::Instance().SubmitArrays(
+        [transform = this->GetTransform(), size = this->states.back().pointSize,
+         depth = Graphics::CURRENT_DEPTH](std::span<const Vector2> points,
+                                          std::span<const Colorf> colors) {
+            ::citro2d::Instance().SetView(transform);
+
+            for (size_t index = 0; index < points.size(); index++)
+            {
+                const Colorf& color = (index < colors.size()) ? colors[index] : colors[0];
+                u32 pointColor      = C2D_Color32f(color.r, color.g, color.b, color.a);
+
+                C2D_DrawCircleSolid(points[index].x, points[index].y, depth, size, pointColor);
+            }
+
+            ::citro2d::Instance().CountDraw(nullptr, points.size() * QUAD_VERTEX_COUNT);
+        },
+        std::span<const Vector2>(points, count), std::span<const Colorf>(colors, colorCount));
 }
 
 void love::citro2d::Graphics::Polyfill(const Vector2* points, size_t count, u32 color, float depth)
 {
-    for (size_t currentPoint = 2; currentPoint < count; currentPoint++)
-    {
-        C2D_DrawTriangle(points[0].x, points[0].y, color, points[currentPoint - 1].x,
-                         points[currentPoint - 1].y, color, points[currentPoint].x,
-                         points[currentPoint].y, color, depth);
-    }
+    if (count < 3)
+        return;
+
+    ::citro2d::Instance().SubmitArrays(
+        [transform = this->GetTransform(), color, depth](std::span<const Vector2> polygon) {
+            ::citro2d::Instance().SetView(transform);
+
+            for (size_t currentPoint = 2; currentPoint < polygon.size(); currentPoint++)
+            {
+                C2D_DrawTriangle(polygon[0].x, polygon[0].y, color, polygon[currentPoint - 1].x,
+                                 polygon[currentPoint - 1].y, color, polygon[currentPoint].x,
+                                 polygon[currentPoint].y, color, depth);
+            }
+
+            ::citro2d::Instance().CountDraw(nullptr, (polygon.size() - 2) * 3);
+        },
+        std::span<const Vector2>(points, count));
 }
 
 void love::citro2d::Graphics::Polygon(DrawMode mode, const Vector2* points, size_t count)
@@ -264,9 +300,6 @@ void love::citro2d::Graphics::Polygon(DrawMode mode, const Vector2* points, size
     Colorf color   = this->GetColor();
     u32 foreground = C2D_Color32f(color.r, color.g, color.b, color.a);
 
-    const Matrix4& t = this->GetTransform();
-    C2D_ViewRestore(&t.GetElements());
-
     if (mode == DRAW_LINE)
         this->Polyline(points, count);
     else
@@ -295,145 +328,128 @@ void love::citro2d::Graphics::Rectangle(DrawMode mode, float x, float y, float w
     this->Polygon(mode, points, 4);
 }
 
-void love::citro2d::Graphics::Rectangle(DrawMode mode, float x, float y, float width, float height,
-                                        float rx, float ry)
+/*
+** Ellipse Drawing Order
+** 1 - 4
+** |   |
+** 2 - 3
+*/
+static void RoundedRectangle(Graphics::DrawMode mode, float x, float y, float width, float height,
+                             float rx, float ry, float lineWidth, u32 foreground, float depth)
 {
-    if (rx == 0 && ry == 0)
-    {
-        this->Rectangle(mode, x, y, width, height);
-        return;
-    }
-
-    Colorf color   = this->GetColor();
-    u32 foreground = C2D_Color32f(color.r, color.g, color.b, color.a);
-
-    const Matrix4& t = this->GetTransform();
-    C2D_ViewRestore(&t.GetElements());
-
     /* Offset the radii *properly* */
     Vector2 offset(x + rx, y + ry);
     Vector2 size(rx * 2, ry * 2);
 
-    /*
-    ** Ellipse Drawing Order
-    ** 1 - 4
-    ** |   |
-    ** 2 - 3
-    */
-
-    if (mode == DRAW_FILL)
+    if (mode == Graphics::DRAW_FILL)
     {
         /* Draw Ellipses first on Fill mode */
 
-        C2D_DrawEllipseSolid(x, y, Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH * 2, size.x,
-                             size.y, foreground);
+        C2D_DrawEllipseSolid(x, y, depth + Graphics::MIN_DEPTH * 2, size.x, size.y, foreground);
 
-        C2D_DrawEllipseSolid(x, y + (height - size.y),
-                             Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH * 2, size.x, size.y,
-                             foreground);
+        C2D_DrawEllipseSolid(x, y + (height - size.y), depth + Graphics::MIN_DEPTH * 2, size.x,
+                             size.y, foreground);
 
         C2D_DrawEllipseSolid(x + (width - size.x), y + (height - size.y),
-                             Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH * 2, size.x, size.y,
-                             foreground);
+                             depth + Graphics::MIN_DEPTH * 2, size.x, size.y, foreground);
 
-        C2D_DrawEllipseSolid(x + (width - size.x), y,
-                             Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH * 2, size.x, size.y,
-                             foreground);
+        C2D_DrawEllipseSolid(x + (width - size.x), y, depth + Graphics::MIN_DEPTH * 2, size.x,
+                             size.y, foreground);
 
         /* Draw Rectangles */
 
-        C2D_DrawRectSolid(offset.x, y, Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH,
-                          width - size.x, height, foreground);
+        C2D_DrawRectSolid(offset.x, y, depth + Graphics::MIN_DEPTH, width - size.x, height,
+                          foreground);
+
+        C2D_DrawRectSolid(x, offset.y, depth, width, height - size.y, foreground);
 
-        C2D_DrawRectSolid(x, offset.y, Graphics::CURRENT_DEPTH, width, height - size.y, foreground);
+        ::citro2d::Instance().CountDraw(nullptr, 6 * QUAD_VERTEX_COUNT);
 
-        Graphics::CURRENT_DEPTH += Graphics::MIN_DEPTH * 2;
+        return;
     }
-    else
+
+    Vector2 innerDiameter((rx - lineWidth) * 2, (ry - lineWidth) * 2);
+    if (innerDiameter.x <= 0 || innerDiameter.y <= 0)
     {
-        float& lineWidth = this->states.back().lineWidth;
+        innerDiameter.x = 0;
+        innerDiameter.y = 0;
+    }
 
-        Vector2 innerDiameter((rx - lineWidth) * 2, (ry - lineWidth) * 2);
-        if (innerDiameter.x <= 0 || innerDiameter.y <= 0)
-        {
-            innerDiameter.x = 0;
-            innerDiameter.y = 0;
-        }
+    /* Transparent rectangles first */
 
-        /* normal rect offset + line width */
-        Vector2 lineOffset((x + rx) + lineWidth, (y + ry) + lineWidth);
+    C2D_DrawRectSolid(x + innerDiameter.x / 2 + lineWidth, y + lineWidth,
+                      depth + Graphics::MIN_DEPTH * 3, width - (lineWidth * 2 + innerDiameter.x),
+                      height - lineWidth * 2, TRANSPARENCY);
 
-        /* normal radii size - line width */
-        Vector2 lineSize((rx * 2) - lineWidth, (ry * 2) - lineWidth);
+    C2D_DrawRectSolid(x + lineWidth, y + innerDiameter.y / 2 + lineWidth,
+                      depth + Graphics::MIN_DEPTH * 3, width - (lineWidth * 2),
+                      height - (lineWidth * 2 + innerDiameter.y), TRANSPARENCY);
 
-        /* normal radii pos + line width */
-        Vector2 linePos(x + lineWidth, y + lineWidth);
+    /* Transparent ellipses second, if they aren't nonexistent */
 
-        /* normal rect size - line width */
-        Vector2 rectSize(width - (lineWidth * 2), height - (lineWidth * 2));
+    if (innerDiameter.x > 0 && innerDiameter.y > 0)
+    {
+        C2D_DrawEllipseSolid(x + lineWidth, y + lineWidth, depth + Graphics::MIN_DEPTH * 3,
+                             innerDiameter.x, innerDiameter.y, TRANSPARENCY);
 
-        /* Transparent rectangles first */
+        C2D_DrawEllipseSolid(x + lineWidth, y + height - ry - innerDiameter.y / 2,
+                             depth + Graphics::MIN_DEPTH * 3, innerDiameter.x, innerDiameter.y,
+                             TRANSPARENCY);
 
-        C2D_DrawRectSolid(x + innerDiameter.x / 2 + lineWidth, y + lineWidth,
-                          Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH * 3,
-                          width - (lineWidth * 2 + innerDiameter.x), height - lineWidth * 2,
-                          TRANSPARENCY);
+        C2D_DrawEllipseSolid(x + width - rx - innerDiameter.x / 2,
+                             y + height - ry - innerDiameter.y / 2,
+                             depth + Graphics::MIN_DEPTH * 3, innerDiameter.x, innerDiameter.y,
+                             TRANSPARENCY);
 
-        C2D_DrawRectSolid(x + lineWidth, y + innerDiameter.y / 2 + lineWidth,
-                          Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH * 3,
-                          width - (lineWidth * 2), height - (lineWidth * 2 + innerDiameter.y),
-                          TRANSPARENCY);
+        C2D_DrawEllipseSolid(x + width - rx - innerDiameter.x / 2, y + lineWidth,
+                             depth + Graphics::MIN_DEPTH * 3, innerDiameter.x, innerDiameter.y,
+                             TRANSPARENCY);
+    }
 
-        /* Transparent ellipses second, if they aren't nonexistent */
+    /* Solid stuff  -- Start with ellipses */
 
-        if (innerDiameter.x > 0 && innerDiameter.y > 0)
-        {
-            C2D_DrawEllipseSolid(x + lineWidth, y + lineWidth,
-                                 Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH * 3, innerDiameter.x,
-                                 innerDiameter.y, TRANSPARENCY);
-
-            C2D_DrawEllipseSolid(x + lineWidth, y + height - ry - innerDiameter.y / 2,
-                                 Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH * 3, innerDiameter.x,
-                                 innerDiameter.y, TRANSPARENCY);
-
-            C2D_DrawEllipseSolid(x + width - rx - innerDiameter.x / 2,
-                                 y + height - ry - innerDiameter.y / 2,
-                                 Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH * 3, innerDiameter.x,
-                                 innerDiameter.y, TRANSPARENCY);
-
-            C2D_DrawEllipseSolid(x + width - rx - innerDiameter.x / 2, y + lineWidth,
-                                 Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH * 3, innerDiameter.x,
-                                 innerDiameter.y, TRANSPARENCY);
-        }
+    C2D_DrawEllipseSolid(x, y, depth + Graphics::MIN_DEPTH * 2, size.x, size.y, foreground);
 
-        /* Solid stuff  -- Start with ellipses */
+    C2D_DrawEllipseSolid(x, y + (height - size.y), depth + Graphics::MIN_DEPTH * 2, size.x,
+                         size.y, foreground);
 
-        C2D_DrawEllipseSolid(x, y, Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH * 2, size.x,
-                             size.y, foreground);
+    C2D_DrawEllipseSolid(x + (width - size.x), y + (height - size.y),
+                         depth + Graphics::MIN_DEPTH * 2, size.x, size.y, foreground);
 
-        C2D_DrawEllipseSolid(x, y + (height - size.y),
-                             Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH * 2, size.x, size.y,
-                             foreground);
+    C2D_DrawEllipseSolid(x + (width - size.x), y, depth + Graphics::MIN_DEPTH * 2, size.x, size.y,
+                         foreground);
 
-        C2D_DrawEllipseSolid(x + (width - size.x), y + (height - size.y),
-                             Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH * 2, size.x, size.y,
-                             foreground);
+    /* Rectangles */
 
-        C2D_DrawEllipseSolid(x + (width - size.x), y,
-                             Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH * 2, size.x, size.y,
-                             foreground);
+    C2D_DrawRectSolid(offset.x, y, depth + Graphics::MIN_DEPTH, width - size.x, height,
+                      foreground);
 
-        /* Rectangles */
+    C2D_DrawRectSolid(x, offset.y, depth, width, height - size.y, foreground);
 
-        C2D_DrawRectSolid(offset.x, y, Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH,
-                          width - size.x, height, foreground);
+    size_t quads = (innerDiameter.x > 0 && innerDiameter.y > 0) ? 12 : 8;
+    ::citro2d::Instance().CountDraw(nullptr, quads * QUAD_VERTEX_COUNT);
+}
 
-        C2D_DrawRectSolid(x, offset.y, Graphics::CURRENT_DEPTH, width, height - size.y, foreground);
+void love::citro2d::Graphics::Rectangle(DrawMode mode, float x, float y, float width, float height,
+                                        float rx, float ry)
+{
+    if (rx == 0 && ry == 0)
+    {
+        this->Rectangle(mode, x, y, width, height);
+        return;
+    }
 
-        /* Ellipses */
+    Colorf color   = this->GetColor();
+    u32 foreground = C2D_Color32f(color.r, color.g, color.b, color.a);
 
-        Graphics::CURRENT_DEPTH += Graphics::MIN_DEPTH * 3;
-    }
+    ::citro2d::Instance().Submit([=, transform = this->GetTransform(),
+                                  lineWidth = this->states.back().lineWidth,
+                                  depth     = Graphics::CURRENT_DEPTH]() {
+        ::citro2d::Instance().SetView(transform);
+        RoundedRectangle(mode, x, y, width, height, rx, ry, lineWidth, foreground, depth);
+    });
+
+    Graphics::CURRENT_DEPTH += Graphics::MIN_DEPTH * ((mode == DRAW_FILL) ? 2 : 3);
 }
 
 void love::citro2d::Graphics::Ellipse(DrawMode mode, float x, float y, float a, float b)
@@ -441,23 +457,46 @@ void love::citro2d::Graphics::Ellipse(DrawMode mode, float x, float y, float a,
     Colorf color   = this->GetColor();
     u32 foreground = C2D_Color32f(color.r, color.g, color.b, color.a);
 
-    const Matrix4& t = this->GetTransform();
-    C2D_ViewRestore(&t.GetElements());
+    ::citro2d::Instance().Submit([=, transform = this->GetTransform(),
+                                  lineWidth = this->states.back().lineWidth,
+                                  depth     = Graphics::CURRENT_DEPTH]() {
+        ::citro2d::Instance().SetView(transform);
 
-    if (mode == DRAW_FILL)
-        C2D_DrawEllipseSolid(x - a, y - b, Graphics::CURRENT_DEPTH, a * 2, b * 2, foreground);
-    else
-    {
-        float lineWidth = this->states.back().lineWidth;
+        if (mode == DRAW_FILL)
+        {
+            C2D_DrawEllipseSolid(x - a, y - b, depth, a * 2, b * 2, foreground);
+            ::citro2d::Instance().CountDraw(nullptr, QUAD_VERTEX_COUNT);
 
-        C2D_DrawEllipseSolid((x - a) + lineWidth, (y - b) + lineWidth,
-                             Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH, (a - lineWidth) * 2,
-                             (b - lineWidth) * 2, TRANSPARENCY);
+            return;
+        }
+
+        C2D_DrawEllipseSolid((x - a) + lineWidth, (y - b) + lineWidth, depth + Graphics::MIN_DEPTH,
+                             (a - lineWidth) * 2, (b - lineWidth) * 2, TRANSPARENCY);
 
-        C2D_DrawEllipseSolid(x - a, y - b, Graphics::CURRENT_DEPTH, a * 2, b * 2, foreground);
+        C2D_DrawEllipseSolid(x - a, y - b, depth, a * 2, b * 2, foreground);
+        ::citro2d::Instance().CountDraw(nullptr, 2 * QUAD_VERTEX_COUNT);
+    });
 
+    if (mode != DRAW_FILL)
         Graphics::CURRENT_DEPTH += Graphics::MIN_DEPTH;
+}
+
+/* A filled circle, or an outline punched out of one with a transparent circle on top */
+static void CircleDisc(Graphics::DrawMode mode, float x, float y, float radius, float lineWidth,
+                       u32 foreground, float depth)
+{
+    if (mode == Graphics::DRAW_FILL)
+    {
+        C2D_DrawCircleSolid(x, y, depth, radius, foreground);
+        ::citro2d::Instance().CountDraw(nullptr, QUAD_VERTEX_COUNT);
+
+        return;
     }
+
+    C2D_DrawCircleSolid(x, y, depth + Graphics::MIN_DEPTH, radius - lineWidth, TRANSPARENCY);
+
+    C2D_DrawCircleSolid(x, y, depth, radius, foreground);
+    ::citro2d::Instance().CountDraw(nullptr, 2 * QUAD_VERTEX_COUNT);
 }
 
 void love::citro2d::Graphics::Circle(DrawMode mode, float x, float y, float radius)
@@ -465,20 +504,15 @@ void love::citro2d::Graphics::Circle(DrawMode mode, float x, float y, float radi
     Colorf color   = this->GetColor();
     u32 foreground = C2D_Color32f(color.r, color.g, color.b, color.a);
 
-    const Matrix4& t = this->GetTransform();
-    C2D_ViewRestore(&t.GetElements());
-
-    if (mode == DRAW_FILL)
-        C2D_DrawCircleSolid(x, y, Graphics::CURRENT_DEPTH, radius, foreground);
-    else
-    {
-        C2D_DrawCircleSolid(x, y, Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH,
-                            radius - this->states.back().lineWidth, TRANSPARENCY);
-
-        C2D_DrawCircleSolid(x, y, Graphics::CURRENT_DEPTH, radius, foreground);
+    ::citro2d::Instance().Submit([=, transform = this->GetTransform(),
+                                  lineWidth = this->states.back().lineWidth,
+                                  depth     = Graphics::CURRENT_DEPTH]() {
+        ::citro2d::Instance().SetView(transform);
+        CircleDisc(mode, x, y, radius, lineWidth, foreground, depth);
+    });
 
+    if (mode != DRAW_FILL)
         Graphics::CURRENT_DEPTH += Graphics::MIN_DEPTH;
-    }
 }
 
 void love::citro2d::Graphics::Arc(DrawMode mode, ArcMode arcmode, float x, float y, float radius,
@@ -499,59 +533,67 @@ void love::citro2d::Graphics::Arc(DrawMode mode, ArcMode arcmode, float x, float
     if (angle2 > angle1)
         angle2 -= M_TAU;
 
-    const Matrix4& t = this->GetTransform();
-    C2D_ViewRestore(&t.GetElements());
+    std::vector<std::array<Vector2, 3>> triangles;
 
     while (angle2 + M_PI_2 < angle1)
     {
-        const auto& pts = calc90Triangle(x, y, angle2);
-        C2D_DrawTriangle(pts[0].x, pts[0].y, TRANSPARENCY, pts[1].x, pts[1].y, TRANSPARENCY,
-                         pts[2].x, pts[2].y, TRANSPARENCY,
-                         Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH);
+        triangles.push_back(calc90Triangle(x, y, angle2));
         angle2 += M_PI_2;
     }
 
-    const std::array<Vector2, 3> finalTriangle = {
+    triangles.push_back({
         Vector2(x, y), Vector2(x + diag_radius * cosf(angle2), y + diag_radius * sinf(angle2)),
         Vector2(x + diag_radius * cosf(angle1), y + diag_radius * sinf(angle1))
-    };
-
-    C2D_DrawTriangle(finalTriangle[0].x, finalTriangle[0].y, TRANSPARENCY, finalTriangle[1].x,
-                     finalTriangle[1].y, TRANSPARENCY, finalTriangle[2].x, finalTriangle[2].y,
-                     TRANSPARENCY, Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH);
+    });
 
     /* Sort of code duplication, but uh.. fix the arcs! */
 
     Colorf color   = this->GetColor();
     u32 foreground = C2D_Color32f(color.r, color.g, color.b, color.a);
 
-    if (mode == DRAW_FILL)
-        C2D_DrawCircleSolid(x, y, Graphics::CURRENT_DEPTH, radius, foreground);
-    else
-    {
-        C2D_DrawCircleSolid(x, y, Graphics::CURRENT_DEPTH + Graphics::MIN_DEPTH,
-                            radius - this->states.back().lineWidth, TRANSPARENCY);
+    ::citro2d::Instance().Submit([=, transform = this->GetTransform(),
+                                  triangles = std::move(triangles),
+                                  lineWidth = this->states.back().lineWidth,
+                                  depth     = Graphics::CURRENT_DEPTH]() {
+        ::citro2d::Instance().SetView(transform);
 
-        C2D_DrawCircleSolid(x, y, Graphics::CURRENT_DEPTH, radius, foreground);
+        for (const auto& pts : triangles)
+        {
+            C2D_DrawTriangle(pts[0].x, pts[0].y, TRANSPARENCY, pts[1].x, pts[1].y, TRANSPARENCY,
+                             pts[2].x, pts[2].y, TRANSPARENCY, depth + Graphics::MIN_DEPTH);
+        }
+
+        ::citro2d::Instance().CountDraw(nullptr, triangles.size() * 3);
 
+        CircleDisc(mode, x, y, radius, lineWidth, foreground, depth);
+    });
+
+    if (mode != DRAW_FILL)
         Graphics::CURRENT_DEPTH += Graphics::MIN_DEPTH;
-    }
 
     Graphics::CURRENT_DEPTH += Graphics::MIN_DEPTH;
 }
 
 void love::citro2d::Graphics::Line(const Vector2* points, int count)
 {
+    if (count < 2)
+        return;
+
     Colorf color   = this->GetColor();
     u32 foreground = C2D_Color32f(color.r, color.g, color.b, color.a);
 
-    const Matrix4& t = this->GetTransform();
-    C2D_ViewRestore(&t.GetElements());
+    ::citro2d::Instance().SubmitArrays(
+        [transform = this->GetTransform(), foreground, lineWidth = this->states.back().lineWidth,
+         depth = Graphics::CURRENT_DEPTH](std::span<const Vector2> line) {
+            ::citro2d::Instance().SetView(transform);
+
+            for (size_t index = 1; index < line.size(); index++)
+                C2D_DrawLine(line[index - 1].x, line[index - 1].y, foreground, line[index].x,
+                             line[index].y, foreground, lineWidth, depth);
 
-    for (size_t index = 1; index < (size_t)count; index++)
-        C2D_DrawLine(points[index - 1].x, points[index - 1].y, foreground, points[index].x,
-                     points[index].y, foreground, this->states.back().lineWidth,
-                     Graphics::CURRENT_DEPTH);
+            ::citro2d::Instance().CountDraw(nullptr, (line.size() - 1) * QUAD_VERTEX_COUNT);
+        },
+        std::span<const Vector2>(points, count));
 }
 
 void love::citro2d::Graphics::SetLineWidth(float width)
@@ -595,4 +637,12 @@ Graphics::RendererInfo love::citro2d::Graphics::GetRendererInfo() const
     return info;
 }
 
+Graphics::Stats love::citro2d::Graphics::GetStats() const
+{
+    Stats stats = love::Graphics::GetStats();
+    ::citro2d::Instance().GetStats(stats);
+
+    return stats;
+}
+
 /* 2D Screens */
@@ -0,0 +1,63 @@
+#include "citro2d/residency.h"
+
+#include "objects/image/image.h"
+
+TextureResidency& TextureResidency::Instance()
+{
+    static TextureResidency residency;
+    return residency;
+}
+
+TextureResidency::Handle TextureResidency::Track(love::Image* image, size_t bytes)
+{
+    this->resident.push_front({ image, bytes, this->frame });
+    return this->resident.begin();
+}
+
+void TextureResidency::Untrack(Handle handle)
+{
+    this->resident.erase(handle);
+}
+
+void TextureResidency::Touch(Handle handle)
+{
+    handle->lastFrame = this->frame;
+
+    if (handle != this->resident.begin())
+        this->resident.splice(this->resident.begin(), this->resident, handle);
+}
+
+bool TextureResidency::EvictLeastRecent()
+{
+    if (this->resident.empty())
+        return false;
+
+    Entry entry = this->resident.back();
+
+    if (entry.lastFrame + 1 >= this->frame)
+        return false;
+
+    /* Image::Evict untracks itself */
+    entry.image->Evict();
+
+    this->stats.evictions++;
+    this->stats.evictedMemory += entry.bytes;
+
+    return true;
+}
+
+void TextureResidency::Restored(size_t bytes)
+{
+    this->stats.restores++;
+    this->stats.evictedMemory -= bytes;
+}
+
+void TextureResidency::Dropped(size_t bytes)
+{
+    this->stats.evictedMemory -= bytes;
+}
+
+void TextureResidency::EndFrame()
+{
+    this->frame++;
+}
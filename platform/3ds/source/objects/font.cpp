@@ -4,6 +4,7 @@
 
 #include "citro2d/citro.h"
 
+#include <algorithm>
 #include <numeric>
 
 using namespace love;
@@ -11,7 +12,8 @@ using namespace love;
 Font::Font(Rasterizer* rasterizer, const Texture::Filter& filter) :
     common::Font(filter),
     rasterizer(rasterizer),
-    buffer(C2D_TextBufNew(Font::FONT_BUFFER_SIZE))
+    buffer(C2D_TextBufNew(Font::FONT_BUFFER_SIZE)),
+    cachedGlyphs(0)
 {
     this->dpiScale = rasterizer->GetDPIScale();
     this->height   = rasterizer->GetHeight();
@@ -24,10 +26,74 @@ Font::Font(Rasterizer* rasterizer, const Texture::Filter& filter) :
 
 Font::~Font()
 {
+    while (!this->textCache.empty())
+        this->EvictText();
+
     C2D_TextBufClear(this->buffer);
     C2D_TextBufDelete(this->buffer);
 }
 
+void Font::EvictText()
+{
+    CachedText& oldest = this->textCache.back();
+
+    C2D_TextBufDelete(oldest.buffer);
+    this->cachedGlyphs -= oldest.glyphs;
+
+    this->textLookup.erase(oldest.string);
+    this->textCache.pop_back();
+}
+
+/*
+** Returns the layout of @string, parsing it only if it isn't cached
+** citro2d applies wrapping and alignment when drawing, so the string
+** alone is the key. Strings too long for the cache are parsed into
+** @scratch using the shared buffer, which the caller clears after
+*/
+const C2D_Text* Font::ParseText(const std::string& string, C2D_Text& scratch)
+{
+    auto found = this->textLookup.find(string);
+
+    if (found != this->textLookup.end())
+    {
+        this->textCache.splice(this->textCache.begin(), this->textCache, found->second);
+        return &found->second->text;
+    }
+
+    /* a glyph takes at least one byte of UTF-8 */
+    size_t glyphs = std::max<size_t>(string.size(), 1);
+
+    if (glyphs <= TEXT_CACHE_GLYPHS)
+    {
+        while (this->cachedGlyphs + glyphs > TEXT_CACHE_GLYPHS)
+            this->EvictText();
+
+        C2D_TextBuf buffer = C2D_TextBufNew(glyphs);
+
+        if (buffer != nullptr)
+        {
+            CachedText& cached = this->textCache.emplace_front();
+
+            cached.string = string;
+            cached.buffer = buffer;
+            cached.glyphs = glyphs;
+
+            C2D_TextFontParse(&cached.text, this->GetFont(), cached.buffer, string.c_str());
+            C2D_TextOptimize(&cached.text);
+
+            this->textLookup.emplace(string, this->textCache.begin());
+            this->cachedGlyphs += glyphs;
+
+            return &cached.text;
+        }
+    }
+
+    C2D_TextFontParse(&scratch, this->GetFont(), this->buffer, string.c_str());
+    C2D_TextOptimize(&scratch);
+
+    return &scratch;
+}
+
 const C2D_Font Font::GetFont()
 {
     auto r = static_cast<BCFNTRasterizer*>(this->rasterizer.Get());
@@ -98,30 +164,32 @@ void Font::GetWrap(const std::vector<Font::ColoredString>& strings, float wrapLi
 void Font::Print(Graphics* gfx, const std::vector<ColoredString>& text,
                  const Matrix4& localTransform, const Colorf& color)
 {
-    C2D_Text citroText;
-
     std::string result = std::accumulate(
         text.begin(), text.end(), std::string {},
         [](const std::string& s1, const ColoredString& piece) { return s1 + piece.string; });
 
-    C2D_TextFontParse(&citroText, this->GetFont(), this->buffer, result.c_str());
-    C2D_TextOptimize(&citroText);
-
     Matrix4 t(gfx->GetTransform(), localTransform);
-    C2D_ViewRestore(&t.GetElements());
-
     u32 renderColorf = C2D_Color32f(color.r, color.g, color.b, color.a);
-    C2D_DrawText(&citroText, C2D_WithColor, 0, 0, Graphics::CURRENT_DEPTH, this->GetScale(),
-                 this->GetScale(), renderColorf);
 
-    C2D_TextBufClear(this->buffer);
+    /* parsed when drawn, so the second eye of a recording hits the cache */
+    ::citro2d::Instance().Submit([self = StrongReference<Font>(this), result = std::move(result), t,
+                                  renderColorf, depth = Graphics::CURRENT_DEPTH]() {
+        C2D_Text scratch;
+        const C2D_Text* citroText = self->ParseText(result, scratch);
+
+        ::citro2d::Instance().SetView(t);
+        C2D_DrawText(citroText, C2D_WithColor, 0, 0, depth, self->GetScale(), self->GetScale(),
+                     renderColorf);
+
+        ::citro2d::Instance().CountText(*citroText);
+
+        C2D_TextBufClear(self->buffer);
+    });
 }
 
 void Font::Printf(Graphics* gfx, const std::vector<ColoredString>& text, float wrap,
                   AlignMode align, const Matrix4& localTransform, const Colorf& color)
 {
-    C2D_Text citroText;
-
     u32 alignMode = C2D_WordWrap;
     float offset  = 0.0f;
 
@@ -147,17 +215,23 @@ void Font::Printf(Graphics* gfx, const std::vector<ColoredString>& text, float w
         text.begin(), text.end(), std::string {},
         [](const std::string& s1, const ColoredString& piece) { return s1 + piece.string; });
 
-    C2D_TextFontParse(&citroText, this->GetFont(), this->buffer, result.c_str());
-    C2D_TextOptimize(&citroText);
-
     Matrix4 t(gfx->GetTransform(), localTransform);
-    C2D_ViewRestore(&t.GetElements());
-
     u32 renderColorf = C2D_Color32f(color.r, color.g, color.b, color.a);
-    C2D_DrawText(&citroText, C2D_WithColor | alignMode, offset, 0, Graphics::CURRENT_DEPTH,
-                 this->GetScale(), this->GetScale(), renderColorf, wrap);
 
-    C2D_TextBufClear(this->buffer);
+    ::citro2d::Instance().Submit([self = StrongReference<Font>(this), result = std::move(result), t,
+                                  renderColorf, alignMode, offset, wrap,
+                                  depth = Graphics::CURRENT_DEPTH]() {
+        C2D_Text scratch;
+        const C2D_Text* citroText = self->ParseText(result, scratch);
+
+        ::citro2d::Instance().SetView(t);
+        C2D_DrawText(citroText, C2D_WithColor | alignMode, offset, 0, depth, self->GetScale(),
+                     self->GetScale(), renderColorf, wrap);
+
+        ::citro2d::Instance().CountText(*citroText);
+
+        C2D_TextBufClear(self->buffer);
+    });
 }
 
 int Font::GetWidth(uint32_t /* prevGlyph */, uint32_t current)
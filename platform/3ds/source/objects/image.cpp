@@ -3,9 +3,15 @@
 
 #include "citro2d/citro.h"
 #include "common/pixelformat.h"
+#include "common/tiling.h"
+
+#include <array>
 
 using namespace love;
 
+/* RGB8 texels, moved as three raw bytes */
+using Texel24 = std::array<uint8_t, 3>;
+
 Image::Image(const Slices& slices, bool validate) :
     Texture(data.GetTextureType()),
     data(slices),
@@ -14,9 +20,12 @@ Image::Image(const Slices& slices, bool validate) :
 {
     if (validate && this->data.Validate() == MIPMAPS_DATA)
         mipmapsType = MIPMAPS_DATA;
+
+    imageCount++;
 }
 
-Image::Image(const Slices& slices) : Image(slices, true)
+/* citro2d only samples the first level, so settings.mipmaps is ignored */
+Image::Image(const Slices& slices, const Settings&) : Image(slices, true)
 {
     this->Init(slices.Get(0, 0));
 }
@@ -36,38 +45,111 @@ void Image::Init(PixelFormat format, int width, int height)
 {
     this->texture.tex = new C3D_Tex();
 
-    int copyWidth = width;
-    if (!::citro2d::IsSizeValid(width))
-        copyWidth = NextPO2(width);
+    this->format = format;
+
+    this->width  = width;
+    this->height = height;
+
+    this->AllocateTexture();
+    this->Upload();
 
-    int copyHeight = height;
-    if (!::citro2d::IsSizeValid(height))
-        copyHeight = NextPO2(height);
+    this->InitQuad();
+
+    this->SetFilter(this->filter);
+    this->SetWrap(this->wrap);
+}
+
+/* Evicts the least recently drawn Images until the texture fits in linear memory */
+void Image::AllocateTexture()
+{
+    int copyWidth = this->width;
+    if (!::citro2d::IsSizeValid(copyWidth))
+        copyWidth = NextPO2(copyWidth);
+
+    int copyHeight = this->height;
+    if (!::citro2d::IsSizeValid(copyHeight))
+        copyHeight = NextPO2(copyHeight);
 
     GPU_TEXCOLOR color;
-    ::citro2d::GetConstant(format, color);
+    ::citro2d::GetConstant(this->format, color);
+
+    TextureResidency& residency = TextureResidency::Instance();
+
+    while (!C3D_TexInit(this->texture.tex, copyWidth, copyHeight, color))
+    {
+        if (!residency.EvictLeastRecent())
+            throw love::Exception("Failed to initialize texture!");
+    }
+
+    this->SetGraphicsMemorySize(this->texture.tex->size);
+
+    this->residency = residency.Track(this, this->texture.tex->size);
+    this->resident  = true;
+}
 
-    if (!C3D_TexInit(this->texture.tex, copyWidth, copyHeight, color))
-        throw love::Exception("Failed to initialize texture!");
+/* Fills the texture from the snapshot taken on eviction, or else the source data */
+void Image::Upload()
+{
+    C3D_Tex* tex = this->texture.tex;
 
-    size_t copySize = copyWidth * copyHeight * GetPixelFormatSize(format);
+    size_t copySize = tex->width * tex->height * GetPixelFormatSize(this->format);
 
-    if (this->data.Get(0, 0))
-        memcpy(this->texture.tex->data, this->data.Get(0, 0)->GetData(), copySize);
+    if (this->snapshot)
+    {
+        memcpy(tex->data, this->snapshot.get(), tex->size);
+        this->snapshot.reset();
+    }
+    else if (this->data.Get(0, 0))
+        memcpy(tex->data, this->data.Get(0, 0)->GetData(), copySize);
     else
-        memset(this->texture.tex->data, 0, copySize);
+        memset(tex->data, 0, copySize);
 
-    C3D_TexFlush(this->texture.tex);
+    C3D_TexFlush(tex);
+}
 
-    this->format = format;
+void Image::Evict()
+{
+    C3D_Tex* tex = this->texture.tex;
 
-    this->width  = width;
-    this->height = height;
+    /* untouched texels come back from the source data, replaced ones are kept on the heap */
+    if (this->dirty)
+    {
+        this->snapshot = std::make_unique<uint8_t[]>(tex->size);
+        memcpy(this->snapshot.get(), tex->data, tex->size);
+    }
 
-    this->InitQuad();
+    C3D_TexDelete(tex);
+    tex->data = nullptr;
 
-    this->SetFilter(this->filter);
-    this->SetWrap(this->wrap);
+    this->SetGraphicsMemorySize(0);
+
+    TextureResidency::Instance().Untrack(this->residency);
+    this->resident = false;
+}
+
+void Image::MakeResident()
+{
+    if (this->resident)
+    {
+        TextureResidency::Instance().Touch(this->residency);
+        return;
+    }
+
+    C3D_Tex* tex = this->texture.tex;
+
+    /* C3D_TexInit resets the filter and wrap modes */
+    u32 param    = tex->param;
+    u32 border   = tex->border;
+    u32 lodParam = tex->lodParam;
+
+    this->AllocateTexture();
+    this->Upload();
+
+    tex->param    = param;
+    tex->border   = border;
+    tex->lodParam = lodParam;
+
+    TextureResidency::Instance().Restored(tex->size);
 }
 
 void Image::ReplacePixels(const void* data, size_t size, const Rect& rect)
@@ -78,6 +160,9 @@ void Image::ReplacePixels(const void* data, size_t size, const Rect& rect)
     if (size == 0)
         throw love::Exception("Failed to replace pixels. Data is nullptr.");
 
+    this->MakeResident();
+    this->dirty = true;
+
     size_t srcPowTwoWidth  = NextPO2(rect.w);
     size_t srcPowTwoHeight = NextPO2(rect.h);
 
@@ -89,35 +174,49 @@ void Image::ReplacePixels(const void* data, size_t size, const Rect& rect)
 
     /* love::Rect should be Po2 already */
 
-    auto getFunction = ImageData::GetPixelGetFunction(this->format);
-    auto setFunction = ImageData::GetPixelSetFunction(this->format);
+    const void* src = data;
+    void* dst       = this->texture.tex->data;
+
+    unsigned dstWidth = this->texture.tex->width;
 
-    for (int y = 0; y < rect.h; y++)
+    switch (GetPixelFormatSize(this->format))
     {
-        for (int x = 0; x < rect.w; x++)
-        {
-            unsigned srcIndex = coordToIndex(srcPowTwoWidth, x, y);
-            unsigned dstIndex = coordToIndex(this->texture.tex->width, x, y);
-
-            Colorf color {};
-
-            /* grab the pixel data from our source */
-            const ImageData::Pixel* srcPixel =
-                reinterpret_cast<const ImageData::Pixel*>((uint32_t*)data + srcIndex);
-            getFunction(srcPixel, color);
-
-            /* set the pixel we got to ours */
-            ImageData::Pixel* dstPixel =
-                reinterpret_cast<ImageData::Pixel*>((uint32_t*)this->texture.tex->data + dstIndex);
-            setFunction(color, dstPixel);
-        }
+        case 4:
+            tiling::CopyTiled((const uint32_t*)src, srcPowTwoWidth, 0, 0, (uint32_t*)dst, dstWidth,
+                              rect.x, rect.y, rect.w, rect.h);
+            break;
+        case 3:
+            tiling::CopyTiled((const Texel24*)src, srcPowTwoWidth, 0, 0, (Texel24*)dst, dstWidth,
+                              rect.x, rect.y, rect.w, rect.h);
+            break;
+        case 2:
+            tiling::CopyTiled((const uint16_t*)src, srcPowTwoWidth, 0, 0, (uint16_t*)dst, dstWidth,
+                              rect.x, rect.y, rect.w, rect.h);
+            break;
+        default:
+            throw love::Exception("Failed to replace pixels. Unsupported pixel format.");
     }
 
     C3D_TexFlush(this->texture.tex);
 }
 
+void Image::GenerateMipmaps()
+{
+    throw love::Exception("Mipmaps are not supported on this console.");
+}
+
 Image::~Image()
 {
-    C3D_TexDelete(this->texture.tex);
+    /* an evicted texture has no texels left to free */
+    if (this->resident)
+    {
+        TextureResidency::Instance().Untrack(this->residency);
+        C3D_TexDelete(this->texture.tex);
+    }
+    else if (this->texture.tex)
+        TextureResidency::Instance().Dropped(this->texture.tex->size);
+
     delete this->texture.tex;
+
+    --imageCount;
 }
@@ -0,0 +1,71 @@
+#include "objects/particlesystem/particlesystem.h"
+
+#include "modules/graphics/graphics.h"
+
+#include "citro2d/citro.h"
+
+using namespace love;
+
+ParticleSystem::ParticleSystem(Texture* texture, uint32_t size) :
+    common::ParticleSystem(texture, size)
+{}
+
+/*
+** The view is set once for the whole system, each particle
+** is then a plain C2D_DrawImage which citro2d batches
+** into a single draw since they all share one texture
+** Particles are resolved to draw parameters up front, so
+** a recorded system replays a copy without touching its state
+*/
+void ParticleSystem::Draw(Graphics* gfx, const Matrix4& localTransform)
+{
+    uint32_t count = this->activeCount;
+
+    if (count == 0)
+        return;
+
+    Quad* quad       = this->texture->GetQuad();
+    C2D_Image image  = this->texture->GetHandle();
+    Quad::Viewport v = quad->GetViewport();
+
+    Tex3DS_SubTexture subTexture = quad->CalculateTex3DSViewport(v, image.tex);
+
+    Matrix4 transform(gfx->GetTransform(), localTransform);
+
+    const Colorf color = gfx->GetColor();
+    const auto& p      = this->particles;
+
+    this->draws.resize(count);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        auto& [params, tint] = this->draws[i];
+        float size           = p.size[i];
+
+        params.pos    = { p.x[i], p.y[i], (float)v.w * size, (float)v.h * size };
+        params.center = { this->offset.x * size, this->offset.y * size };
+        params.angle  = p.angle[i];
+        params.depth  = Graphics::CURRENT_DEPTH;
+
+        u32 tintColor = C2D_Color32f(p.r[i] * color.r, p.g[i] * color.g, p.b[i] * color.b,
+                                     p.a[i] * color.a);
+
+        C2D_PlainImageTint(&tint, tintColor, 1);
+    }
+
+    using Draw = std::pair<C2D_DrawParams, C2D_ImageTint>;
+
+    ::citro2d::Instance().SubmitArrays(
+        [texture = this->texture, image, subTexture,
+         transform](std::span<const Draw> draws) mutable {
+            image.subtex = &subTexture;
+            ::citro2d::Instance().SetView(transform);
+
+            for (const auto& [params, tint] : draws)
+            {
+                C2D_DrawImage(image, &params, &tint);
+                ::citro2d::Instance().CountDraw(image.tex, 6);
+            }
+        },
+        std::span<const Draw>(this->draws));
+}
@@ -14,14 +14,23 @@ void Quad::Refresh(const Viewport& viewport, double sw, double sh)
 
 const Tex3DS_SubTexture& Quad::CalculateTex3DSViewport(const Viewport& viewport, C3D_Tex* texture)
 {
-    this->subTex.top  = 1.0f - (viewport.y) / texture->height;
-    this->subTex.left = (viewport.x) / texture->width;
+    this->subTex = Quad::GetTex3DSViewport(viewport, texture);
 
-    this->subTex.right  = (viewport.x + viewport.w) / texture->width;
-    this->subTex.bottom = 1.0f - ((viewport.y + viewport.h) / texture->height);
+    return this->subTex;
+}
 
-    this->subTex.width  = viewport.w;
-    this->subTex.height = viewport.h;
+Tex3DS_SubTexture Quad::GetTex3DSViewport(const Viewport& viewport, C3D_Tex* texture)
+{
+    Tex3DS_SubTexture subTex;
 
-    return this->subTex;
+    subTex.top  = 1.0f - (viewport.y) / texture->height;
+    subTex.left = (viewport.x) / texture->width;
+
+    subTex.right  = (viewport.x + viewport.w) / texture->width;
+    subTex.bottom = 1.0f - ((viewport.y + viewport.h) / texture->height);
+
+    subTex.width  = viewport.w;
+    subTex.height = viewport.h;
+
+    return subTex;
 }
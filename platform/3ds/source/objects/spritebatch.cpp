@@ -0,0 +1,101 @@
+#include "objects/spritebatch/spritebatch.h"
+
+#include "modules/graphics/graphics.h"
+
+#include "citro2d/citro.h"
+
+using namespace love;
+
+SpriteBatch::SpriteBatch(Texture* texture, int size, vertex::Usage usage) :
+    common::SpriteBatch(texture, size, usage)
+{
+    this->sprites.resize(size);
+}
+
+void SpriteBatch::SetBufferSize(int newSize)
+{
+    if (newSize <= 0)
+        throw love::Exception("Invalid SpriteBatch size.");
+
+    this->size = newSize;
+    this->next = std::min(this->next, newSize);
+
+    this->sprites.resize(newSize);
+}
+
+int SpriteBatch::Add(Quad* quad, const Matrix4& transform, int index)
+{
+    int spriteIndex = this->GetAddIndex(index);
+    Sprite& sprite  = this->sprites[spriteIndex];
+
+    const C2D_Image& image = this->texture->GetHandle();
+
+    sprite.viewport   = quad->GetViewport();
+    sprite.subTexture = Quad::GetTex3DSViewport(sprite.viewport, image.tex);
+    sprite.transform  = transform;
+
+    u32 color = C2D_Color32f(this->color.r, this->color.g, this->color.b, this->color.a);
+    C2D_PlainImageTint(&sprite.tint, color, 1);
+
+    if (index == -1)
+        this->next++;
+
+    return spriteIndex;
+}
+
+/* The subtextures were worked out against the old texture's size */
+void SpriteBatch::SetTexture(love::Texture* texture)
+{
+    common::SpriteBatch::SetTexture(texture);
+
+    C3D_Tex* tex = this->texture->GetHandle().tex;
+
+    for (int index = 0; index < this->next; index++)
+    {
+        Sprite& sprite    = this->sprites[index];
+        sprite.subTexture = Quad::GetTex3DSViewport(sprite.viewport, tex);
+    }
+}
+
+/* Nothing is buffered on the GPU, sprites are always submitted as-is */
+void SpriteBatch::Flush()
+{}
+
+void SpriteBatch::Draw(Graphics* gfx, const Matrix4& localTransform)
+{
+    int start = 0;
+    int count = 0;
+
+    this->GetDrawSpan(start, count);
+
+    if (count <= 0)
+        return;
+
+    Matrix4 base(gfx->GetTransform(), localTransform);
+    C2D_Image image = this->texture->GetHandle();
+
+    C2D_DrawParams params;
+
+    params.depth  = Graphics::CURRENT_DEPTH;
+    params.angle  = 0.0f;
+    params.center = { 0.0f, 0.0f };
+
+    /* a recorded draw gets a copy, so later edits don't leak into it */
+    ::citro2d::Instance().SubmitArrays(
+        [texture = this->texture, base, image, params](std::span<const Sprite> span) mutable {
+            /* citro2d merges consecutive images that share a texture into one draw */
+            for (const Sprite& sprite : span)
+            {
+                Matrix4 transform(base, sprite.transform);
+                ::citro2d::Instance().SetView(transform);
+
+                image.subtex = &sprite.subTexture;
+                params.pos   = { 0.0f, 0.0f, (float)sprite.subTexture.width,
+                                 (float)sprite.subTexture.height };
+
+                C2D_DrawImage(image, &params, &sprite.tint);
+                ::citro2d::Instance().CountDraw(image.tex, 6);
+            }
+        },
+        std::span<const Sprite>(this->sprites.data() + start, count));
+}
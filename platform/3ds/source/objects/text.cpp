@@ -1,6 +1,8 @@
 #include "objects/text/text.h"
 #include "modules/graphics/graphics.h"
 
+#include "citro2d/citro.h"
+
 #include <numeric>
 
 using namespace love;
@@ -8,14 +10,11 @@ using namespace love;
 Text::Text(love::Font* font, const std::vector<Font::ColoredString>& text) :
     common::Text(font, text)
 {
-    this->buffer = C2D_TextBufNew(Font::FONT_BUFFER_SIZE);
     this->Set(text);
 }
 
 Text::~Text()
-{
-    C2D_TextBufDelete(this->buffer);
-}
+{}
 
 void Text::SetFont(love::Font* font)
 {
@@ -67,9 +66,19 @@ void Text::Set(const std::vector<Font::ColoredString>& text, float wrap, Font::A
     this->wrap  = wrap;
     this->align = align;
 
-    C2D_TextBufClear(this->buffer);
-    C2D_TextFontParse(&this->text, this->font->GetFont(), this->buffer, this->textCache.c_str());
-    C2D_TextOptimize(&this->text);
+    this->Parse();
+}
+
+/* A layout that a recorded draw still holds is left alone, the new text gets its own */
+void Text::Parse()
+{
+    if (!this->layout || this->layout.use_count() > 1)
+        this->layout = std::make_shared<Layout>();
+
+    C2D_TextBufClear(this->layout->buffer);
+    C2D_TextFontParse(&this->layout->text, this->font->GetFont(), this->layout->buffer,
+                      this->textCache.c_str());
+    C2D_TextOptimize(&this->layout->text);
 }
 
 int Text::Add(const std::vector<Font::ColoredString>& text, const Matrix4& localTransform)
@@ -97,17 +106,17 @@ int Text::Addf(const std::vector<Font::ColoredString>& text, float wrap, Font::A
 
     this->wrapData.push_back(std::make_pair(wrap, align));
 
-    C2D_TextBufClear(this->buffer);
-    C2D_TextFontParse(&this->text, this->font->GetFont(), this->buffer, this->textCache.c_str());
-    C2D_TextOptimize(&this->text);
+    this->Parse();
 
     return 0;
 }
 
 void Text::Draw(Graphics* gfx, const Matrix4& localTransform)
 {
+    if (!this->layout)
+        return;
+
     Matrix4 t(gfx->GetTransform(), localTransform);
-    C2D_ViewRestore(&t.GetElements());
 
     Colorf color = gfx->GetColor();
 
@@ -140,13 +149,19 @@ void Text::Draw(Graphics* gfx, const Matrix4& localTransform)
         flags |= alignMode;
 
     /* wrap will be discarded if there's no align mode specified */
-    C2D_DrawText(&this->text, flags, offset, 0, Graphics::CURRENT_DEPTH, this->font->GetScale(),
-                 this->font->GetScale(), renderColorf, this->wrap);
+    ::citro2d::Instance().Submit([layout = this->layout, t, flags, offset, renderColorf,
+                                  scale = this->font->GetScale(), wrap = this->wrap,
+                                  depth = Graphics::CURRENT_DEPTH]() {
+        ::citro2d::Instance().SetView(t);
+        C2D_DrawText(&layout->text, flags, offset, 0, depth, scale, scale, renderColorf, wrap);
+
+        ::citro2d::Instance().CountText(layout->text);
+    });
 }
 
 void Text::Clear()
 {
-    C2D_TextBufClear(this->buffer);
+    this->layout.reset();
     this->textCache.clear();
     this->wrapData.clear();
 }
\ No newline at end of file
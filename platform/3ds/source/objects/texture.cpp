@@ -15,6 +15,7 @@ void Texture::Draw(Graphics* gfx, const Matrix4& localTransform)
 
 const C2D_Image& Texture::GetHandle()
 {
+    this->MakeResident();
     return this->texture;
 }
 
@@ -31,10 +32,10 @@ void Texture::SetFilter(const Filter& filter)
 
 void Texture::Draw(Graphics* gfx, love::Quad* quad, const Matrix4& localTransform)
 {
+    C2D_Image image  = this->GetHandle();
     Quad::Viewport v = quad->GetViewport();
 
-    Tex3DS_SubTexture tv = quad->CalculateTex3DSViewport(v, this->texture.tex);
-    this->texture.subtex = &tv;
+    Tex3DS_SubTexture tv = quad->CalculateTex3DSViewport(v, image.tex);
 
     // Multiply the current and local transforms
     Matrix4 t(gfx->GetTransform(), localTransform);
@@ -46,11 +47,19 @@ void Texture::Draw(Graphics* gfx, love::Quad* quad, const Matrix4& localTransfor
     params.angle  = 0.0f;
     params.center = { 0.0f, 0.0f };
 
-    C2D_ViewRestore(&t.GetElements());
-
     C2D_ImageTint tint;
     Colorf color = gfx->GetColor();
 
     C2D_PlainImageTint(&tint, C2D_Color32f(color.r, color.g, color.b, color.a), 1);
-    C2D_DrawImage(this->texture, &params, &tint);
+
+    /* the texture is kept alive until a recorded draw has been replayed */
+    ::citro2d::Instance().Submit(
+        [self = StrongReference<Texture>(this), image, tv, t, params, tint]() mutable {
+            image.subtex = &tv;
+
+            ::citro2d::Instance().SetView(t);
+            C2D_DrawImage(image, &params, &tint);
+
+            ::citro2d::Instance().CountDraw(image.tex, 6);
+        });
 }
@@ -0,0 +1,197 @@
+/*
+** Checks the copy kernels of common/tiling.h against a plain
+** copy that works out every texel's address on its own
+*/
+#include "common/tiling.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace love::tiling;
+
+namespace
+{
+    /* x in the even bits, y in the odd ones */
+    unsigned Morton(unsigned x, unsigned y)
+    {
+        unsigned offset = 0;
+
+        for (unsigned bit = 0; bit < 3; bit++)
+        {
+            offset |= ((x >> bit) & 1) << (bit * 2);
+            offset |= ((y >> bit) & 1) << (bit * 2 + 1);
+        }
+
+        return offset;
+    }
+
+    unsigned Address(unsigned width, unsigned x, unsigned y)
+    {
+        unsigned tile = (y / TILE_SIZE) * (width / TILE_SIZE) + (x / TILE_SIZE);
+        return tile * TILE_TEXELS + Morton(x % TILE_SIZE, y % TILE_SIZE);
+    }
+
+    template<typename T>
+    void ReferenceCopy(const T* src, unsigned srcWidth, unsigned sx, unsigned sy, T* dst,
+                       unsigned dstWidth, unsigned dx, unsigned dy, unsigned width,
+                       unsigned height)
+    {
+        for (unsigned y = 0; y < height; y++)
+        {
+            for (unsigned x = 0; x < width; x++)
+                dst[Address(dstWidth, dx + x, dy + y)] = src[Address(srcWidth, sx + x, sy + y)];
+        }
+    }
+
+    int failures = 0;
+
+    void Expect(bool condition, const char* what)
+    {
+        if (condition)
+            return;
+
+        std::fprintf(stderr, "FAILED: %s\n", what);
+        failures++;
+    }
+
+    void CheckMortonTable()
+    {
+        bool matches = true;
+
+        for (unsigned y = 0; y < TILE_SIZE; y++)
+        {
+            for (unsigned x = 0; x < TILE_SIZE; x++)
+                matches = matches && MORTON[y * TILE_SIZE + x] == Morton(x, y);
+        }
+
+        Expect(matches, "MORTON matches the bit interleave");
+    }
+
+    template<typename T>
+    struct Case
+    {
+        unsigned srcWidth, srcHeight;
+        unsigned dstWidth, dstHeight;
+        unsigned sx, sy, dx, dy;
+        unsigned width, height;
+    };
+
+    /* Runs @copy and the reference on the same buffers, which then have to be identical */
+    template<typename T, typename F>
+    bool Matches(const Case<T>& test, std::mt19937& random, F copy)
+    {
+        std::vector<T> src(test.srcWidth * test.srcHeight);
+        std::vector<T> dst(test.dstWidth * test.dstHeight);
+
+        for (T& texel : src)
+            texel = static_cast<T>(random());
+
+        for (T& texel : dst)
+            texel = static_cast<T>(random());
+
+        std::vector<T> expected = dst;
+
+        ReferenceCopy(src.data(), test.srcWidth, test.sx, test.sy, expected.data(),
+                      test.dstWidth, test.dx, test.dy, test.width, test.height);
+
+        copy(src.data(), test.srcWidth, test.sx, test.sy, dst.data(), test.dstWidth, test.dx,
+             test.dy, test.width, test.height);
+
+        return dst == expected;
+    }
+
+    /* Random blocks that fit both textures, with tile-aligned corners half of the time */
+    template<typename T>
+    void CheckCopies(const char* type, std::mt19937& random)
+    {
+        const unsigned sizes[] = { 8, 16, 32, 64, 128, 256 };
+
+        int tiledFailures  = 0;
+        int texelsFailures = 0;
+
+        for (int iteration = 0; iteration < 2000; iteration++)
+        {
+            Case<T> test {};
+
+            test.srcWidth  = sizes[random() % 6];
+            test.srcHeight = sizes[random() % 6];
+            test.dstWidth  = sizes[random() % 6];
+            test.dstHeight = sizes[random() % 6];
+
+            unsigned maxWidth  = std::min(test.srcWidth, test.dstWidth);
+            unsigned maxHeight = std::min(test.srcHeight, test.dstHeight);
+
+            test.width  = 1 + random() % maxWidth;
+            test.height = 1 + random() % maxHeight;
+
+            test.sx = random() % (test.srcWidth - test.width + 1);
+            test.sy = random() % (test.srcHeight - test.height + 1);
+            test.dx = random() % (test.dstWidth - test.width + 1);
+            test.dy = random() % (test.dstHeight - test.height + 1);
+
+            if (random() % 2 == 0)
+            {
+                test.sx -= test.sx % TILE_SIZE;
+                test.sy -= test.sy % TILE_SIZE;
+                test.dx -= test.dx % TILE_SIZE;
+                test.dy -= test.dy % TILE_SIZE;
+            }
+
+            if (!Matches(test, random, CopyTiled<T>))
+                tiledFailures++;
+
+            if (!Matches(test, random, CopyTexels<T>))
+                texelsFailures++;
+        }
+
+        char what[64];
+
+        std::snprintf(what, sizeof(what), "CopyTiled<%s> matches the reference", type);
+        Expect(tiledFailures == 0, what);
+
+        std::snprintf(what, sizeof(what), "CopyTexels<%s> matches the reference", type);
+        Expect(texelsFailures == 0, what);
+    }
+
+    /* Whole textures, the path texture uploads take most */
+    template<typename T>
+    void CheckWholeTextures(const char* type, std::mt19937& random)
+    {
+        bool matches = true;
+
+        for (unsigned width : { 8U, 64U, 512U })
+        {
+            for (unsigned height : { 8U, 32U, 256U })
+            {
+                Case<T> test { width, height, width, height, 0, 0, 0, 0, width, height };
+                matches = matches && Matches(test, random, CopyTiled<T>);
+            }
+        }
+
+        char what[64];
+        std::snprintf(what, sizeof(what), "CopyTiled<%s> copies whole textures", type);
+
+        Expect(matches, what);
+    }
+} // namespace
+
+int main()
+{
+    std::mt19937 random(0x3D5);
+
+    CheckMortonTable();
+
+    CheckCopies<uint8_t>("uint8_t", random);
+    CheckCopies<uint16_t>("uint16_t", random);
+    CheckCopies<uint32_t>("uint32_t", random);
+
+    CheckWholeTextures<uint16_t>("uint16_t", random);
+    CheckWholeTextures<uint32_t>("uint32_t", random);
+
+    if (failures == 0)
+        std::printf("tiling: all checks passed\n");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -1,29 +1,52 @@
 #pragma once
 
 #include "common/exception.h"
-#include <bitset>
 #include <deko3d.h>
 
-template<size_t N>
-class BitwiseAlloc : std::bitset<N>
+#include <vector>
+
+/*
+** Hands out texture descriptor indices in constant time
+** Freed indices are reused first, then new ones are taken
+** from the end. Allocate fails once the capacity is used up
+** so the owner can grow its descriptor sets and Reserve more
+*/
+class BitwiseAlloc
 {
   public:
-    size_t Allocate()
+    BitwiseAlloc(size_t capacity) : used(capacity, false), next(0), count(0)
+    {}
+
+    bool Allocate(size_t& index)
     {
-        size_t index = 0;
-        while (index < this->size() && this->test(index))
-            ++index;
+        if (!this->freed.empty())
+        {
+            index = this->freed.back();
+            this->freed.pop_back();
+        }
+        else if (this->next < this->used.size())
+            index = this->next++;
+        else
+            return false;
 
-        this->set(index);
-        return index;
+        this->used[index] = true;
+        this->count++;
+
+        return true;
     }
 
-    size_t Find(DkResHandle handle)
+    void Reserve(size_t capacity)
+    {
+        if (capacity > this->used.size())
+            this->used.resize(capacity, false);
+    }
+
+    size_t Find(DkResHandle handle) const
     {
         size_t index = (handle & ((1U << 20) - 1));
 
 #if defined(__DEBUG__)
-        if (!this->test(index))
+        if (index >= this->used.size() || !this->used[index])
             throw love::Exception("Texture allocator bit %zu not set!", index);
 #endif
 
@@ -33,6 +56,30 @@ class BitwiseAlloc : std::bitset<N>
     void DeAllocate(DkResHandle handle)
     {
         size_t index = this->Find(handle);
-        this->reset(index);
+
+        if (index >= this->used.size() || !this->used[index])
+            return;
+
+        this->used[index] = false;
+        this->freed.push_back(index);
+        this->count--;
     }
-};
\ No newline at end of file
+
+    /* Number of indices currently handed out */
+    size_t GetCount() const
+    {
+        return this->count;
+    }
+
+    size_t GetCapacity() const
+    {
+        return this->used.size();
+    }
+
+  private:
+    std::vector<bool> used;
+    std::vector<size_t> freed;
+
+    size_t next;
+    size_t count;
+};
@@ -6,17 +6,20 @@
 #include "CMemPool.h"
 #include "common.h"
 
-template<unsigned NumSlices>
+#include <algorithm>
+
+template<unsigned MaxSlices>
 class CCmdMemRing
 {
-    static_assert(NumSlices > 0, "Need a non-zero number of slices...");
+    static_assert(MaxSlices > 0, "Need a non-zero number of slices...");
 
     CMemPool::Handle m_mem;
+    unsigned m_numSlices;
     unsigned m_curSlice;
-    dk::Fence m_fences[NumSlices];
+    dk::Fence m_fences[MaxSlices];
 
   public:
-    CCmdMemRing() : m_mem {}, m_curSlice {}, m_fences {}
+    CCmdMemRing() : m_mem {}, m_numSlices {}, m_curSlice {}, m_fences {}
     {}
 
     ~CCmdMemRing()
@@ -24,13 +27,20 @@ class CCmdMemRing
         m_mem.destroy();
     }
 
-    bool allocate(CMemPool& pool, uint32_t sliceSize)
+    bool allocate(CMemPool& pool, uint32_t sliceSize, unsigned numSlices = MaxSlices)
     {
+        m_numSlices = std::clamp(numSlices, 1U, MaxSlices);
+
         sliceSize = (sliceSize + DK_CMDMEM_ALIGNMENT - 1) & ~(DK_CMDMEM_ALIGNMENT - 1);
-        m_mem     = pool.allocate(NumSlices * sliceSize);
+        m_mem     = pool.allocate(m_numSlices * sliceSize);
         return m_mem;
     }
 
+    unsigned getSliceCount() const
+    {
+        return m_numSlices;
+    }
+
     void begin(dk::CmdBuf cmdbuf)
     {
         // Clear/reset the command buffer, which also destroys all command list handles
@@ -38,7 +48,7 @@ class CCmdMemRing
         cmdbuf.clear();
 
         // Wait for the current slice of memory to be available, and feed it to the command buffer
-        uint32_t sliceSize = m_mem.getSize() / NumSlices;
+        uint32_t sliceSize = m_mem.getSize() / m_numSlices;
         m_fences[m_curSlice].wait();
 
         // Feed the memory to the command buffer
@@ -54,7 +64,7 @@ class CCmdMemRing
         cmdbuf.signalFence(m_fences[m_curSlice]);
 
         // Advance the current slice counter; wrapping around when we reach the end
-        m_curSlice = (m_curSlice + 1) % NumSlices;
+        m_curSlice = (m_curSlice + 1) % m_numSlices;
 
         // Finish off the command list, returning it to the caller
         return cmdbuf.finishList();
@@ -9,28 +9,75 @@
 
 #include "vertex.h"
 
-template<unsigned NumSlices>
+#include <vector>
+
+template<unsigned MaxSlices>
 class CCmdVtxRing
 {
-    static_assert(NumSlices > 0, "Need a non-zero number of slices...");
+    static_assert(MaxSlices > 0, "Need a non-zero number of slices...");
 
+    CMemPool* m_pool;
     CMemPool::Handle m_mem;
+    unsigned m_numSlices;
     unsigned m_curSlice;
     uint32_t m_sliceSize;
 
+    // Signalled once the GPU is done reading a slice
+    dk::Fence m_fences[MaxSlices];
+    bool m_acquired;
+
+    // Extra buffers chained on when a frame outgrows its slice
+    std::vector<CMemPool::Handle> m_spills[MaxSlices];
+
+    void release(unsigned slice)
+    {
+        for (auto& handle : m_spills[slice])
+            handle.destroy();
+
+        m_spills[slice].clear();
+    }
+
+    /*
+    ** Wait for the GPU to finish with the current slice, only
+    ** once per frame and only right before it gets written to
+    */
+    void acquire()
+    {
+        if (m_acquired)
+            return;
+
+        m_fences[m_curSlice].wait();
+        release(m_curSlice);
+
+        m_acquired = true;
+    }
+
   public:
-    CCmdVtxRing() : m_mem {}, m_curSlice {}, m_sliceSize {}
+    CCmdVtxRing() :
+        m_pool {},
+        m_mem {},
+        m_numSlices {},
+        m_curSlice {},
+        m_sliceSize {},
+        m_fences {},
+        m_acquired {},
+        m_spills {}
     {}
 
     ~CCmdVtxRing()
     {
+        for (unsigned slice = 0; slice < MaxSlices; slice++)
+            release(slice);
+
         m_mem.destroy();
     }
 
-    bool allocate(CMemPool& pool, uint32_t size)
+    bool allocate(CMemPool& pool, uint32_t size, unsigned numSlices = MaxSlices)
     {
+        m_pool      = &pool;
+        m_numSlices = std::clamp(numSlices, 1U, MaxSlices);
         m_sliceSize = (size + DK_CMDMEM_ALIGNMENT - 1) & ~(DK_CMDMEM_ALIGNMENT - 1);
-        m_mem       = pool.allocate(NumSlices * m_sliceSize, alignof(vertex::Vertex));
+        m_mem       = pool.allocate(m_numSlices * m_sliceSize, alignof(vertex::Vertex));
 
         return m_mem;
     }
@@ -38,23 +85,60 @@ class CCmdVtxRing
     /* Return current buffer's size */
     const uint32_t getSize()
     {
-        return m_mem.getSize() / NumSlices;
+        acquire();
+
+        if (!m_spills[m_curSlice].empty())
+            return m_spills[m_curSlice].back().getSize();
+
+        return m_sliceSize;
     }
 
-    /* Return the current slice data */
+    /* Return the current buffer's data */
     std::pair<void*, DkGpuAddr> begin()
     {
+        acquire();
+
+        if (!m_spills[m_curSlice].empty())
+        {
+            const auto& spill = m_spills[m_curSlice].back();
+            return std::make_pair(spill.getCpuAddr(), spill.getGpuAddr());
+        }
+
         const auto offset = m_curSlice * m_sliceSize;
         return std::make_pair((void*)((char*)m_mem.getCpuAddr() + offset),
                               m_mem.getGpuAddr() + offset);
     }
 
     /*
-    ** Advance the current slice counter
+    ** Chain a buffer of at least @size bytes onto the current slice
+    ** and make it the current buffer. It lives as long as the slice
+    ** does, so it is released when the slice comes around again
+    */
+    bool spill(uint32_t size)
+    {
+        acquire();
+
+        CMemPool::Handle mem =
+            m_pool->allocate(std::max(size, m_sliceSize), alignof(vertex::Vertex));
+
+        if (!mem)
+            return false;
+
+        m_spills[m_curSlice].push_back(mem);
+
+        return true;
+    }
+
+    /*
+    ** Signal the current slice's fence once the GPU gets past
+    ** @cmdbuf's draws, then move on to the next slice
     ** Wrap around when we reach the end
     */
-    void end()
+    void end(dk::CmdBuf cmdbuf)
     {
-        m_curSlice = (m_curSlice + 1) % NumSlices;
+        cmdbuf.signalFence(m_fences[m_curSlice]);
+
+        m_curSlice = (m_curSlice + 1) % m_numSlices;
+        m_acquired = false;
     }
 };
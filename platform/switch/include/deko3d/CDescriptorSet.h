@@ -6,10 +6,8 @@
 #include "CMemPool.h"
 #include "common.h"
 
-template<unsigned NumDescriptors>
 class CDescriptorSet
 {
-    static_assert(NumDescriptors > 0, "Need a non-zero number of descriptors...");
     static_assert(sizeof(DkImageDescriptor) == sizeof(DkSamplerDescriptor), "shouldn't happen");
     static_assert(DK_IMAGE_DESCRIPTOR_ALIGNMENT == DK_SAMPLER_DESCRIPTOR_ALIGNMENT,
                   "shouldn't happen");
@@ -17,29 +15,56 @@ class CDescriptorSet
     static constexpr size_t DescriptorAlign = DK_IMAGE_DESCRIPTOR_ALIGNMENT;
 
     CMemPool::Handle m_mem;
+    uint32_t m_numDescriptors;
 
   public:
-    CDescriptorSet() : m_mem {}
+    CDescriptorSet() : m_mem {}, m_numDescriptors {}
     {}
     ~CDescriptorSet()
     {
         m_mem.destroy();
     }
 
-    bool allocate(CMemPool& pool)
+    bool allocate(CMemPool& pool, uint32_t numDescriptors)
     {
-        m_mem = pool.allocate(NumDescriptors * DescriptorSize, DescriptorAlign);
+        m_mem            = pool.allocate(numDescriptors * DescriptorSize, DescriptorAlign);
+        m_numDescriptors = numDescriptors;
         return m_mem;
     }
 
+    /*
+    ** Move to room for @numDescriptors, copying the current ones over on the GPU
+    ** The set has to be bound again afterwards, and @retired must outlive
+    ** every command that still reads from the old memory
+    */
+    bool grow(CMemPool& pool, dk::CmdBuf cmdbuf, uint32_t numDescriptors,
+              CMemPool::Handle& retired)
+    {
+        CMemPool::Handle mem = pool.allocate(numDescriptors * DescriptorSize, DescriptorAlign);
+        if (!mem)
+            return false;
+
+        cmdbuf.copyBuffer(m_mem.getGpuAddr(), mem.getGpuAddr(), m_numDescriptors * DescriptorSize);
+
+        retired          = m_mem;
+        m_mem            = mem;
+        m_numDescriptors = numDescriptors;
+        return true;
+    }
+
+    uint32_t getCount() const
+    {
+        return m_numDescriptors;
+    }
+
     void bindForImages(dk::CmdBuf cmdbuf)
     {
-        cmdbuf.bindImageDescriptorSet(m_mem.getGpuAddr(), NumDescriptors);
+        cmdbuf.bindImageDescriptorSet(m_mem.getGpuAddr(), m_numDescriptors);
     }
 
     void bindForSamplers(dk::CmdBuf cmdbuf)
     {
-        cmdbuf.bindSamplerDescriptorSet(m_mem.getGpuAddr(), NumDescriptors);
+        cmdbuf.bindSamplerDescriptorSet(m_mem.getGpuAddr(), m_numDescriptors);
     }
 
     template<typename T>
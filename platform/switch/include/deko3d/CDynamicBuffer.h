@@ -0,0 +1,64 @@
+#pragma once
+
+#include "deko3d/CMemPool.h"
+#include "deko3d/common.h"
+
+#include "common/vertexc.h"
+
+#include <vector>
+
+/*
+** A region is only written in place while no frame that may still
+** be running on the GPU has drawn from it. Otherwise the write goes
+** to a spare region that is done, or a new one, which gets all of
+** the data. Memory is only freed through deko3d::Retire
+**
+** How many spares are kept follows the usage hint: none for static
+** data, one for dynamic and a whole ring's worth for stream, which
+** is rewritten every frame
+*/
+class CDynamicBuffer
+{
+    struct Region
+    {
+        CMemPool::Handle memory;
+        uint64_t lastUse;
+        bool used;
+    };
+
+    Region m_current;
+    std::vector<Region> m_spares;
+
+    uint32_t m_capacity;
+    uint32_t m_alignment;
+    size_t m_maxSpares;
+
+    bool isIdle(const Region& region) const;
+
+    bool replace();
+
+  public:
+    CDynamicBuffer(uint32_t capacity, uint32_t alignment,
+                   vertex::Usage usage = vertex::USAGE_DYNAMIC);
+
+    CDynamicBuffer(CDynamicBuffer const&) = delete;
+
+    ~CDynamicBuffer();
+
+    constexpr uint32_t getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /* Let go of every region, the next update allocates @capacity bytes */
+    void resize(uint32_t capacity);
+
+    /*
+    ** @data is the first @size bytes of the whole CPU copy, out of
+    ** which [@dirtyStart, @dirtyEnd) changed since the last update
+    */
+    bool update(const void* data, uint32_t size, uint32_t dirtyStart, uint32_t dirtyEnd);
+
+    /* The region to draw from, which the current frame now reads */
+    const CMemPool::Handle& use();
+};
@@ -18,18 +18,19 @@ class CImage
     dk::ImageDescriptor m_descriptor;
     CMemPool::Handle m_mem;
 
+    uint32_t m_width;
+    uint32_t m_height;
+    uint32_t m_mipLevels;
+
   public:
-    CImage() : m_image {}, m_descriptor {}, m_mem {}
+    CImage() : m_image {}, m_descriptor {}, m_mem {}, m_width {}, m_height {}, m_mipLevels { 1 }
     {}
 
     CImage(CImage const&) = delete;
 
     CImage(CImage&&) = delete;
 
-    ~CImage()
-    {
-        m_mem.destroy();
-    }
+    ~CImage();
 
     constexpr operator bool() const
     {
@@ -46,19 +47,45 @@ class CImage
         return m_descriptor;
     }
 
+    constexpr uint32_t getSize() const
+    {
+        return m_mem ? m_mem.getSize() : 0;
+    }
+
+    constexpr uint32_t getMipLevels() const
+    {
+        return m_mipLevels;
+    }
+
+    /*
+    ** @mipmaps is the number of levels to allocate, only the first is loaded
+    ** With @blitMipmaps, generateMipmaps can fill in the others
+    */
     bool load(love::PixelFormat format, bool isSRGB, void* buffer, size_t size, int width,
-              int height, bool empty = false);
+              int height, bool empty = false, int mipmaps = 1, bool blitMipmaps = false);
+
+    /*
+    ** Uploads are queued on the renderer's upload ring and
+    ** complete asynchronously, before the next frame samples them
+    */
+    bool loadEmptyPixels(CMemPool& imagePool, dk::Device device, uint32_t width, uint32_t height,
+                         DkImageFormat format, uint32_t flags = 0, uint32_t mipLevels = 1);
+
+    bool replacePixels(const void* data, size_t size, const love::Rect& rect);
+
+    /* Upload a whole mip @level, e.g. one that came with compressed data */
+    bool replaceMipmap(const void* data, size_t size, uint32_t level);
 
-    bool loadEmptyPixels(CMemPool& imagePool, CMemPool& scratchPool, dk::Device device,
-                         dk::Queue queue, uint32_t width, uint32_t height, DkImageFormat format,
-                         uint32_t flags = 0);
+    /* Downsample every level after the first one on the GPU */
+    bool generateMipmaps();
 
-    bool replacePixels(CMemPool& scratchPool, dk::Device device, const void* data, size_t size,
-                       dk::Queue transferQueue, const love::Rect& rect);
+    bool loadMemory(CMemPool& imagePool, dk::Device device, const void* data, uint32_t width,
+                    uint32_t height, DkImageFormat format, uint32_t flags = 0,
+                    uint32_t mipLevels = 1);
 
-    bool loadMemory(CMemPool& imagePool, CMemPool& scratchPool, dk::Device device,
-                    dk::Queue transferQueue, const void* data, uint32_t width, uint32_t height,
-                    DkImageFormat format, uint32_t flags = 0);
+    /* Remap the channels seen when sampling, e.g. to read R8 as alpha */
+    void setSwizzle(DkImageSwizzle red, DkImageSwizzle green, DkImageSwizzle blue,
+                    DkImageSwizzle alpha);
 
     size_t getFormatSize(DkImageFormat format);
 
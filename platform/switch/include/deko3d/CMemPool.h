@@ -12,6 +12,7 @@ class CMemPool
     dk::Device m_dev;
     uint32_t m_flags;
     uint32_t m_blockSize;
+    uint32_t m_used;
 
     struct Block
     {
@@ -143,6 +144,7 @@ class CMemPool
         m_dev { dev },
         m_flags { flags },
         m_blockSize { blockSize },
+        m_used {},
         m_blocks {},
         m_memMap {},
         m_sliceHeap {},
@@ -151,6 +153,12 @@ class CMemPool
     ~CMemPool();
 
     Handle allocate(uint32_t size, uint32_t alignment = DK_CMDMEM_ALIGNMENT);
+
+    /* Bytes currently handed out, alignment padding excluded */
+    constexpr uint32_t getUsed() const
+    {
+        return m_used;
+    }
 };
 
 constexpr bool operator<(uint32_t lhs, CMemPool::Slice const& rhs)
@@ -0,0 +1,255 @@
+#pragma once
+
+#include "deko3d/CMemPool.h"
+#include "deko3d/common.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+/* Staging memory and the commands that copy it into textures, in batches */
+template<unsigned NumSlices>
+class CUploadRing
+{
+    static_assert(NumSlices > 0, "Need a non-zero number of slices...");
+
+    // Copies recorded into one slice before it gets submitted
+    static constexpr uint32_t MAX_COPIES = 0x100;
+
+    CMemPool* m_pool;
+    dk::Queue m_queue;
+    dk::UniqueCmdBuf m_cmdBuf;
+
+    CMemPool::Handle m_cmdMem;
+    CMemPool::Handle m_staging;
+
+    uint32_t m_cmdSliceSize;
+    uint32_t m_stagingSliceSize;
+
+    unsigned m_curSlice;
+    uint32_t m_offset;
+    uint32_t m_copies;
+
+    dk::Fence m_fences[NumSlices];
+    std::vector<CMemPool::Handle> m_oversized[NumSlices];
+
+    dk::Fence* m_pending;
+
+    static constexpr uint32_t align(uint32_t size, uint32_t alignment)
+    {
+        return (size + alignment - 1) & ~(alignment - 1);
+    }
+
+    void begin()
+    {
+        // Wait for the copies which last used this slice, then hand its memory back out
+        m_cmdBuf.clear();
+        m_fences[m_curSlice].wait();
+
+        for (auto& handle : m_oversized[m_curSlice])
+            handle.destroy();
+
+        m_oversized[m_curSlice].clear();
+
+        m_cmdBuf.addMemory(m_cmdMem.getMemBlock(),
+                           m_cmdMem.getOffset() + m_curSlice * m_cmdSliceSize, m_cmdSliceSize);
+
+        m_offset = 0;
+        m_copies = 0;
+    }
+
+  public:
+    CUploadRing() :
+        m_pool {},
+        m_queue {},
+        m_cmdBuf {},
+        m_cmdMem {},
+        m_staging {},
+        m_cmdSliceSize {},
+        m_stagingSliceSize {},
+        m_curSlice {},
+        m_offset {},
+        m_copies {},
+        m_fences {},
+        m_oversized {},
+        m_pending {}
+    {}
+
+    ~CUploadRing()
+    {
+        if (!m_staging)
+            return;
+
+        sync();
+
+        for (auto& handles : m_oversized)
+        {
+            for (auto& handle : handles)
+                handle.destroy();
+        }
+
+        m_staging.destroy();
+        m_cmdMem.destroy();
+    }
+
+    bool allocate(CMemPool& pool, dk::Device device, dk::Queue queue, uint32_t cmdSize,
+                  uint32_t stagingSize)
+    {
+        m_pool   = &pool;
+        m_queue  = queue;
+        m_cmdBuf = dk::CmdBufMaker { device }.create();
+
+        m_cmdSliceSize = align(cmdSize, DK_CMDMEM_ALIGNMENT);
+        m_cmdMem       = pool.allocate(NumSlices * m_cmdSliceSize);
+
+        m_stagingSliceSize = align(stagingSize, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT);
+        m_staging =
+            pool.allocate(NumSlices * m_stagingSliceSize, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT);
+
+        if (!m_cmdMem || !m_staging)
+            return false;
+
+        begin();
+
+        return true;
+    }
+
+    /*
+    ** Stage @size bytes from @data (zeroes when null) and record
+    ** a copy of them into @image's @mipLevel. Nothing is submitted here,
+    ** the copies go out together when the slice fills up or on flush
+    */
+    bool upload(dk::Image& image, const void* data, uint32_t size, const DkImageRect& rect,
+                uint32_t mipLevel = 0)
+    {
+        uint32_t alignedSize = align(size, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT);
+
+        bool fits = alignedSize <= (m_stagingSliceSize - m_offset);
+
+        if (m_copies == MAX_COPIES || (!fits && alignedSize <= m_stagingSliceSize))
+        {
+            flush();
+            fits = alignedSize <= m_stagingSliceSize;
+        }
+
+        void* cpuAddr     = nullptr;
+        DkGpuAddr gpuAddr = DK_GPU_ADDR_INVALID;
+
+        if (fits)
+        {
+            uint32_t offset = m_curSlice * m_stagingSliceSize + m_offset;
+
+            cpuAddr = (char*)m_staging.getCpuAddr() + offset;
+            gpuAddr = m_staging.getGpuAddr() + offset;
+
+            m_offset += alignedSize;
+        }
+        else
+        {
+            // Bigger than a whole slice, so it lives on its own until this slice retires
+            CMemPool::Handle memory =
+                m_pool->allocate(alignedSize, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT);
+
+            if (!memory)
+                return false;
+
+            m_oversized[m_curSlice].push_back(memory);
+
+            cpuAddr = memory.getCpuAddr();
+            gpuAddr = memory.getGpuAddr();
+        }
+
+        if (data != nullptr)
+            memcpy(cpuAddr, data, size);
+        else
+            memset(cpuAddr, 0, size);
+
+        dk::ImageView imageView { image };
+        imageView.setMipLevels(mipLevel, 1);
+
+        m_cmdBuf.copyBufferToImage({ gpuAddr }, imageView, rect);
+
+        m_copies++;
+
+        return true;
+    }
+
+    /*
+    ** Record linear blits that fill mip levels 1 to @levels - 1
+    ** of @image, each one downsampled from the level above it
+    ** The image must have been created with DkImageFlags_Usage2DEngine
+    */
+    void generateMipmaps(dk::Image& image, uint32_t width, uint32_t height, uint32_t levels)
+    {
+        if (m_copies + levels > MAX_COPIES)
+            flush();
+
+        for (uint32_t level = 1; level < levels; level++)
+        {
+            uint32_t srcWidth  = std::max(width >> (level - 1), 1U);
+            uint32_t srcHeight = std::max(height >> (level - 1), 1U);
+
+            dk::ImageView srcView { image };
+            srcView.setMipLevels(level - 1, 1);
+
+            dk::ImageView dstView { image };
+            dstView.setMipLevels(level, 1);
+
+            // The level above has to be fully written before it is read
+            m_cmdBuf.barrier(DkBarrier_Full, DkInvalidateFlags_Image);
+
+            m_cmdBuf.blitImage(srcView, { 0, 0, 0, srcWidth, srcHeight, 1 }, dstView,
+                               { 0, 0, 0, std::max(srcWidth >> 1, 1U),
+                                 std::max(srcHeight >> 1, 1U), 1 },
+                               DkBlitFlag_FilterLinear);
+
+            m_copies++;
+        }
+    }
+
+    /*
+    ** Submit the copies recorded so far and signal this slice's fence
+    ** The CPU does not wait for them to finish
+    */
+    void flush()
+    {
+        if (m_copies == 0)
+            return;
+
+        m_cmdBuf.signalFence(m_fences[m_curSlice]);
+        m_queue.submitCommands(m_cmdBuf.finishList());
+        m_queue.flush();
+
+        m_pending  = &m_fences[m_curSlice];
+        m_curSlice = (m_curSlice + 1) % NumSlices;
+
+        begin();
+    }
+
+    /* Make the copies recorded from now on wait on the GPU for @fence */
+    void waitFor(dk::Fence& fence)
+    {
+        m_cmdBuf.waitFence(fence);
+    }
+
+    /* Make @queue wait on the GPU for every upload submitted so far */
+    void waitOn(dk::Queue queue)
+    {
+        flush();
+
+        if (m_pending == nullptr)
+            return;
+
+        queue.waitFence(*m_pending);
+        m_pending = nullptr;
+    }
+
+    /* Block the CPU until every upload has landed */
+    void sync()
+    {
+        flush();
+
+        for (auto& fence : m_fences)
+            fence.wait();
+    }
+};
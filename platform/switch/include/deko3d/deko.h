@@ -8,6 +8,7 @@
 #include "deko3d/CImage.h"
 #include "deko3d/CMemPool.h"
 #include "deko3d/CShader.h"
+#include "deko3d/CUploadRing.h"
 #include "deko3d/shader.h"
 
 #include "objects/canvas/canvas.h"
@@ -15,6 +16,7 @@
 #include "objects/texture/texture.h"
 
 #include "common/lmath.h"
+#include "common/matrix.h"
 #include "deko3d/vertex.h"
 #include "graphics/graphics.h"
 
@@ -24,6 +26,7 @@
                                            // types
 #define GLM_FORCE_INTRINSICS // Enables usage of SIMD CPU instructions (requiring the above as well)
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
 #include <glm/mat4x4.hpp>
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
@@ -43,13 +46,30 @@ class deko3d
   public:
     static constexpr unsigned MAX_FRAMEBUFFERS = 2;
 
-    static constexpr unsigned COMMAND_SIZE      = 0x100000;
-    static constexpr size_t VERTEX_COMMAND_SIZE = 0x100000;
+    /* Frames the CPU may record ahead of the GPU, triple buffering at most */
+    static constexpr unsigned MAX_RING_SLICES = 3;
 
-    static constexpr size_t MAX_OBJECTS = 0x250;
+    static constexpr unsigned COMMAND_SIZE = 0x100000;
+
+    /* Per-slice vertex ring size, unless conf.lua asks for another one */
+    static constexpr size_t DEFAULT_VERTEX_BUFFER_SIZE = 0x80000;
+
+    static constexpr unsigned UPLOAD_COMMAND_SIZE = 0x10000;
+    static constexpr unsigned UPLOAD_STAGING_SIZE = 0x200000;
+
+    /* Texture descriptors to start with, the sets double when they run out */
+    static constexpr size_t DESCRIPTOR_COUNT = 0x250;
+
+    /* A texture handle only has 12 bits for the sampler index */
+    static constexpr size_t MAX_DESCRIPTORS = 0x1000;
 
     static deko3d& Instance();
 
+    /* These only have an effect before the renderer is first used */
+    static void SetVertexBufferSize(size_t size);
+
+    static void SetRingSliceCount(unsigned count);
+
     ~deko3d();
 
     void CreateFramebufferResources();
@@ -141,21 +161,124 @@ class deko3d
         return this->pool.data;
     }
 
+    CUploadRing<MAX_FRAMEBUFFERS>& GetUploads()
+    {
+        return this->uploads;
+    }
+
+    /*
+    ** The upload ring, ready to record a texture upload that lands
+    ** after every draw recorded so far and before any later one
+    */
+    CUploadRing<MAX_FRAMEBUFFERS>& BeginUpload();
+
+    /*
+    ** Frames are numbered in the order they are recorded. Memory
+    ** read by a draw of frame N can be written again once
+    ** IsFrameDone(N), which follows the command ring's fences
+    */
+    uint64_t GetFrame() const
+    {
+        return this->frames.current;
+    }
+
+    bool IsFrameDone(uint64_t frame) const
+    {
+        return frame < this->frames.completed;
+    }
+
+    /* Destroy @memory once no frame recorded so far can read it */
+    void Retire(CMemPool::Handle memory);
+
     DkResHandle RegisterResHandle(const dk::ImageDescriptor& descriptor);
 
     void UnRegisterResHandle(DkResHandle handle);
 
-    bool RenderTexture(const DkResHandle handle, const vertex::Vertex* points, size_t count);
+    void UpdateResHandle(DkResHandle handle, const dk::ImageDescriptor& descriptor);
+
+    /*
+    ** The Render functions take their vertices in the space of
+    ** @transform, which is applied by the vertex shader. Draws
+    ** only batch together while they share the same transform
+    */
+    bool RenderTexture(const DkResHandle handle, const vertex::Vertex* points, size_t count,
+                       const love::Matrix4& transform);
 
-    bool RenderVideo(const DkResHandle handles[3], const vertex::Vertex* points, size_t count);
+    bool RenderVideo(const DkResHandle handles[3], const vertex::Vertex* points, size_t count,
+                     const love::Matrix4& transform);
 
     /* Primitives Rendering */
 
-    bool RenderPolygon(const vertex::Vertex* points, size_t count);
+    /*
+    ** Room for @count untextured vertices in the current vertex slice
+    ** Write them in place, then hand the number written to
+    ** CommitVertices before anything else is drawn
+    */
+    vertex::Vertex* ReserveVertices(DkPrimitive mode, size_t count,
+                                    const love::Matrix4& transform);
 
-    bool RenderPolyline(DkPrimitive mode, const vertex::Vertex* points, size_t count);
+    void CommitVertices(size_t count);
 
-    bool RenderPoints(const vertex::Vertex* points, size_t count);
+    /* A range of vertex::Instance in a persistent buffer */
+    struct Instances
+    {
+        const CMemPool::Handle* buffer;
+        uint32_t first;
+        uint32_t count;
+    };
+
+    /*
+    ** Draw from a persistent vertex buffer instead of the vertex ring
+    ** The vertices are transformed on the GPU by @transform
+    ** With @indices, @first and @count refer to 32-bit indices
+    ** which are offset by @baseVertex. With @instances, the
+    ** geometry is drawn once for each of them
+    */
+    bool RenderBuffer(DkPrimitive mode, const DkResHandle* handle, const CMemPool::Handle& buffer,
+                      uint32_t first, uint32_t count, const love::Matrix4& transform,
+                      const CMemPool::Handle* indices = nullptr, uint32_t baseVertex = 0,
+                      const Instances* instances = nullptr);
+
+    /*
+    ** Draw each of @runs from @buffer with its own texture. The
+    ** state, transform and buffer are only bound once for all
+    */
+    bool RenderBufferRuns(DkPrimitive mode, const CMemPool::Handle& buffer,
+                          std::span<const vertex::BufferRun> runs,
+                          const love::Matrix4& transform);
+
+    /*
+    ** Draw the texture quad @points once for each of @instances,
+    ** each one sized by its texture rect. The points go through
+    ** the vertex ring
+    */
+    bool RenderInstanced(DkPrimitive mode, const DkResHandle* handle,
+                         const vertex::Vertex* points, size_t count,
+                         const love::Matrix4& transform, const Instances& instances);
+
+    /*
+    ** Applies @local to @count positions on the CPU when it is a
+    ** 2D affine transform and returns what is left for the GPU,
+    ** so that draws under the same @global transform can batch
+    */
+    template<typename Vdst, typename Vsrc>
+    static love::Matrix4 SplitTransform(const love::Matrix4& global, const love::Matrix4& local,
+                                        Vdst* dst, const Vsrc* src, int count)
+    {
+        if (local.IsAffine2DTransform())
+        {
+            local.TransformXY(dst, src, count);
+            return global;
+        }
+
+        for (int index = 0; index < count; index++)
+        {
+            dst[index].x = src[index].x;
+            dst[index].y = src[index].y;
+        }
+
+        return love::Matrix4(global, local);
+    }
 
     static DkWrapMode GetDekoWrapMode(love::Texture::WrapMode wrap);
 
@@ -165,17 +288,32 @@ class deko3d
 
     void SetDekoBarrier(DkBarrier barrier, uint32_t flags);
 
+    void FlushBatch();
+
+    /* Fills in the renderer counters of @stats */
+    void GetStats(love::Graphics::Stats& stats) const;
+
   private:
     vertex::Vertex* vertexData;
+    DkGpuAddr vertexDataAddr;
 
     uint32_t firstVertex = 0;
-    BitwiseAlloc<MAX_OBJECTS> allocator;
+    size_t reserved      = 0;
+    BitwiseAlloc allocator;
+
+    static inline size_t vertexBufferSize = DEFAULT_VERTEX_BUFFER_SIZE;
+    static inline unsigned ringSlices     = MAX_FRAMEBUFFERS;
+
+    bool SpillVertices(size_t count);
 
     enum State
     {
         STATE_PRIMITIVE,
         STATE_TEXTURE,
         STATE_VIDEO,
+        STATE_INSTANCED,
+        STATE_INSTANCED_TEXTURE,
+        STATE_INSTANCED_QUAD,
         STATE_MAX_ENUM
     };
 
@@ -186,13 +324,73 @@ class deko3d
 
     void EnsureInState(State state);
 
+    /* @state defaults to the one for @handle and @instances */
+    uint32_t PrepareDraw(const DkResHandle* handle, const love::Matrix4& transform,
+                         const Instances* instances, State state = STATE_MAX_ENUM);
+
+    template<size_t Attribs, size_t Buffers>
+    void BindVertexFormat(const std::array<DkVtxAttribState, Attribs>& attribs,
+                          const std::array<DkVtxBufferState, Buffers>& buffers);
+
+    /*
+    ** Consecutive draws that share the same state, primitive,
+    ** textures and transform are appended to one vertex range and
+    ** drawn together when that changes or the frame is presented
+    */
+    struct
+    {
+        State state      = STATE_MAX_ENUM;
+        DkPrimitive mode = DkPrimitive_Quads;
+
+        DkResHandle handles[3] = { 0 };
+        size_t handleCount     = 0;
+
+        glm::mat4 transform = glm::mat4(1.0f);
+
+        uint32_t first = 0;
+        uint32_t count = 0;
+    } batch;
+
+    bool CanMergeBatch(State state, DkPrimitive mode, const DkResHandle* handles,
+                       size_t handleCount, const glm::mat4& transform);
+
+    vertex::Vertex* PrepareBatch(State state, DkPrimitive mode, const DkResHandle* handles,
+                                 size_t handleCount, size_t count, const love::Matrix4& transform);
+
     struct
     {
-        CDescriptorSet<MAX_OBJECTS> image;
-        CDescriptorSet<MAX_OBJECTS> sampler;
+        int drawCalls        = 0;
+        int drawCallsBatched = 0;
+        int canvasSwitches   = 0;
+        int shaderSwitches   = 0;
+        int textureBinds     = 0;
+        int vertices         = 0;
+        int skippedBinds     = 0;
+
+        uint32_t ringVertices    = 0;
+        uint32_t vertexHighWater = 0;
+    } stats;
+
+    struct
+    {
+        CDescriptorSet image;
+        CDescriptorSet sampler;
         bool dirty = false;
     } descriptors;
 
+    void GrowDescriptors();
+
+    struct
+    {
+        uint64_t current   = 0;
+        uint64_t completed = 0;
+
+        /* memory waiting on the frame it was retired in, oldest first */
+        std::vector<std::pair<uint64_t, CMemPool::Handle>> retired;
+    } frames;
+
+    void ReleaseRetired();
+
     struct Transformation
     {
         glm::mat4 mdlvMtx;
@@ -223,8 +421,22 @@ class deko3d
 
     dk::UniqueQueue textureQueue;
 
-    CCmdMemRing<MAX_FRAMEBUFFERS> cmdRing;
-    CCmdVtxRing<MAX_FRAMEBUFFERS> vtxRing;
+    CCmdMemRing<MAX_RING_SLICES> cmdRing;
+    CCmdVtxRing<MAX_RING_SLICES> vtxRing;
+    CUploadRing<MAX_FRAMEBUFFERS> uploads;
+
+    /*
+    ** Uploads run on their own queue, so they wait for the render
+    ** commands submitted before them, which may sample the old
+    ** texels. A frame is split at an upload for the same reason
+    */
+    struct
+    {
+        dk::Fence rendered;
+
+        bool waited   = true;
+        int drawCalls = 0;
+    } uploadOrder;
 
     love::Rect viewport;
     love::Rect scissor;
@@ -242,7 +454,12 @@ class deko3d
 
         bool inFrame = false;
         int slot     = -1;
-        bool dirty   = false;
+
+        /* nullptr is the screen, empty until something is bound this frame */
+        std::optional<love::Canvas*> target;
+
+        /* canvases rendered to since the last fragment barrier */
+        std::vector<DkResHandle> written;
     } framebuffers;
 
     bool descriptorsDirty;
@@ -257,6 +474,46 @@ class deko3d
     Transformation transformState;
     CMemPool::Handle transformUniformBuffer;
 
+    void SetModelViewMatrix(const glm::mat4& matrix);
+
+    /*
+    ** What has been recorded to the GPU so far, so that binds
+    ** which would not change anything are skipped. GPU state
+    ** carries over between command lists, and so does this
+    */
+    struct
+    {
+        const love::Shader::Program* program = nullptr;
+        const DkVtxAttribState* attributes   = nullptr;
+
+        DkGpuAddr vertexBuffer    = DK_GPU_ADDR_INVALID;
+        uint32_t vertexBufferSize = 0;
+
+        DkResHandle textures[3] = { 0 };
+        size_t textureCount     = 0;
+
+        std::optional<love::Rect> scissor;
+        std::optional<love::Rect> viewport;
+        std::optional<Transformation> transform;
+
+        /* blend, rasterizer and color state changed outside of a frame */
+        bool pipelineDirty = true;
+    } bound;
+
+    void BindVertexBuffer(DkGpuAddr address, uint32_t size);
+
+    void BindTextures(const DkResHandle* handles, size_t count);
+
+    void MarkCanvasWritten(love::Canvas* canvas);
+
+    void ResolveCanvasWrites(const DkResHandle* handles, size_t count);
+
+    void PushTransformation();
+
+    void BindPipelineState();
+
+    void SetRasterizerState(const dk::RasterizerState& rasterizer);
+
     dk::ImageLayout layoutFramebuffer;
     std::array<DkImage const*, MAX_FRAMEBUFFERS> framebufferArray;
 
@@ -3,6 +3,11 @@
 #include "modules/graphics/graphics.h"
 
 #include "deko3d/deko.h"
+#include "polyline/polyline.h"
+
+#include <list>
+#include <span>
+#include <unordered_map>
 
 #define RENDERER_NAME    "deko3d"
 #define RENDERER_VERSION "0.4.0"
@@ -89,10 +94,31 @@ namespace love::deko3d
 
         RendererInfo GetRendererInfo() const override;
 
+        Stats GetStats() const override;
+
         // Internal?
         Shader* NewShader(Shader::StandardShader type);
 
       private:
         int CalculateEllipsePoints(float rx, float ry) const;
+
+        const std::vector<uint32_t>* GetTriangulation(std::span<const Vector2> polygon);
+
+        PolylineArena polylineArena;
+
+        /* Triangles of the concave polygons filled most recently */
+        struct Triangulation
+        {
+            uint64_t hash;
+
+            std::vector<Vector2> points;
+            std::vector<uint32_t> indices;
+        };
+
+        static constexpr size_t MAX_TRIANGULATIONS = 0x40;
+
+        /* most recently used first, the last one is reused when full */
+        std::list<Triangulation> triangulations;
+        std::unordered_map<uint64_t, std::list<Triangulation>::iterator> triangulationLookup;
     };
 } // namespace love::deko3d
@@ -26,6 +26,9 @@ namespace love
             STANDARD_DEFAULT,
             STANDARD_TEXTURE,
             STANDARD_VIDEO,
+            STANDARD_INSTANCED,
+            STANDARD_INSTANCED_TEXTURE,
+            STANDARD_INSTANCED_QUAD,
             STANDARD_MAX_ENUM
         };
 
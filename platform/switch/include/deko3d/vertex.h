@@ -6,6 +6,7 @@
 #include "common/colors.h"
 #include "common/vector.h"
 
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <span>
@@ -14,13 +15,46 @@ using namespace love;
 
 namespace vertex
 {
+    using Color8 = std::array<uint8_t, 4>;
+
+    /*
+    ** Packed 2D vertex: position, RGBA8 color and unorm16 texcoords
+    ** Keeping it at 16 bytes fits more vertices into each ring slice
+    */
     struct Vertex
     {
-        float position[3];
-        float color[4];
+        float position[2];
+        Color8 color;
         uint16_t texcoord[2];
     };
 
+    static_assert(sizeof(Vertex) == 16, "vertex::Vertex must stay packed to 16 bytes");
+
+    /* Vertices [first, first + count) of a persistent buffer, drawn with one texture */
+    struct BufferRun
+    {
+        DkResHandle handle;
+        uint32_t first;
+        uint32_t count;
+    };
+
+    /*
+    ** Per-instance data for instanced draws: the base geometry is
+    ** scaled, rotated and then offset, its color is multiplied and
+    ** its texcoords are mapped into texRect (x, y, w, h). Texture
+    ** quads are also scaled down to the size of that rect
+    */
+    struct Instance
+    {
+        float offset[2];
+        float scale[2];
+        float rotation;
+        Color8 color;
+        uint16_t texRect[4];
+    };
+
+    static_assert(sizeof(Instance) == 32, "vertex::Instance must stay packed to 32 bytes");
+
     struct GlyphVertex
     {
         float x, y;
@@ -57,6 +91,16 @@ namespace vertex
         return uint16_t(in * 0xFFFF);
     }
 
+    static inline uint8_t normto8t(float in)
+    {
+        return uint8_t(std::clamp(in, 0.0f, 1.0f) * 0xFF + 0.5f);
+    }
+
+    static inline Color8 PackColor(const Colorf& color)
+    {
+        return { normto8t(color.r), normto8t(color.g), normto8t(color.b), normto8t(color.a) };
+    }
+
     namespace attributes
     {
         /* Primitives */
@@ -66,10 +110,10 @@ namespace vertex
         };
 
         constexpr std::array<DkVtxAttribState, 2> PrimitiveAttribState = {
-            DkVtxAttribState { 0, 0, offsetof(vertex::Vertex, position), DkVtxAttribSize_3x32,
+            DkVtxAttribState { 0, 0, offsetof(vertex::Vertex, position), DkVtxAttribSize_2x32,
                                DkVtxAttribType_Float, 0 },
-            DkVtxAttribState { 0, 0, offsetof(vertex::Vertex, color), DkVtxAttribSize_4x32,
-                               DkVtxAttribType_Float, 0 }
+            DkVtxAttribState { 0, 0, offsetof(vertex::Vertex, color), DkVtxAttribSize_4x8,
+                               DkVtxAttribType_Unorm, 0 }
         };
 
         /*  Textures */
@@ -79,48 +123,47 @@ namespace vertex
         };
 
         constexpr std::array<DkVtxAttribState, 3> TextureAttribState = {
-            DkVtxAttribState { 0, 0, offsetof(vertex::Vertex, position), DkVtxAttribSize_3x32,
-                               DkVtxAttribType_Float, 0 },
-            DkVtxAttribState { 0, 0, offsetof(vertex::Vertex, color), DkVtxAttribSize_4x32,
+            DkVtxAttribState { 0, 0, offsetof(vertex::Vertex, position), DkVtxAttribSize_2x32,
                                DkVtxAttribType_Float, 0 },
+            DkVtxAttribState { 0, 0, offsetof(vertex::Vertex, color), DkVtxAttribSize_4x8,
+                               DkVtxAttribType_Unorm, 0 },
             DkVtxAttribState { 0, 0, offsetof(vertex::Vertex, texcoord), DkVtxAttribSize_2x16,
                                DkVtxAttribType_Unorm, 0 }
         };
-    } // namespace attributes
 
-    [[nodiscard]] static inline std::unique_ptr<Vertex[]> GeneratePrimitiveFromVectors(
-        std::span<Vector2> points, std::span<Colorf> colors)
-    {
-        Colorf color = colors[0];
-
-        size_t pointCount = points.size();
-        auto result       = std::make_unique<Vertex[]>(pointCount);
-
-        size_t colorCount = colors.size();
-
-        for (size_t index = 0; index < pointCount; index++)
-        {
-            const Vector2 point = points[index];
-
-            if (index < colorCount)
-                color = colors[index];
+        /* Instances, the second buffer advances once per instance */
 
-            Vertex append = { .position = { point.x, point.y, 0.0f },
-                              .color    = { color.r, color.g, color.b, color.a },
-                              .texcoord = { 0, 0 } };
-
-            result[index] = append;
-        }
+        constexpr std::array<DkVtxBufferState, 2> InstanceBufferState = {
+            DkVtxBufferState { sizeof(vertex::Vertex), 0 },
+            DkVtxBufferState { sizeof(vertex::Instance), 1 },
+        };
 
-        return result;
-    }
+        constexpr std::array<DkVtxAttribState, 8> InstanceAttribState = {
+            DkVtxAttribState { 0, 0, offsetof(vertex::Vertex, position), DkVtxAttribSize_2x32,
+                               DkVtxAttribType_Float, 0 },
+            DkVtxAttribState { 0, 0, offsetof(vertex::Vertex, color), DkVtxAttribSize_4x8,
+                               DkVtxAttribType_Unorm, 0 },
+            DkVtxAttribState { 0, 0, offsetof(vertex::Vertex, texcoord), DkVtxAttribSize_2x16,
+                               DkVtxAttribType_Unorm, 0 },
+            DkVtxAttribState { 1, 0, offsetof(vertex::Instance, offset), DkVtxAttribSize_2x32,
+                               DkVtxAttribType_Float, 0 },
+            DkVtxAttribState { 1, 0, offsetof(vertex::Instance, scale), DkVtxAttribSize_2x32,
+                               DkVtxAttribType_Float, 0 },
+            DkVtxAttribState { 1, 0, offsetof(vertex::Instance, rotation), DkVtxAttribSize_1x32,
+                               DkVtxAttribType_Float, 0 },
+            DkVtxAttribState { 1, 0, offsetof(vertex::Instance, color), DkVtxAttribSize_4x8,
+                               DkVtxAttribType_Unorm, 0 },
+            DkVtxAttribState { 1, 0, offsetof(vertex::Instance, texRect), DkVtxAttribSize_4x16,
+                               DkVtxAttribType_Unorm, 0 }
+        };
+    } // namespace attributes
 
     std::vector<Vertex> GenerateTextureFromVectors(const love::Vector2* points,
                                                    const love::Vector2* texcoord, size_t count,
                                                    Colorf color);
 
-    std::vector<vertex::Vertex> GenerateTextureFromGlyphs(const vertex::GlyphVertex* verts,
-                                                          size_t count);
+    void GenerateTextureFromGlyphs(const vertex::GlyphVertex* verts, size_t count,
+                                   vertex::Vertex* out);
 
     bool GetConstant(const char* in, CullMode& out);
     bool GetConstant(CullMode in, const char*& out);
@@ -126,6 +126,9 @@ namespace love
 
         void SetFilter(const Texture::Filter& filter);
 
+        /* Upload every glyph rasterized since the last call */
+        void UploadGlyphs();
+
       private:
         struct TextureSize
         {
@@ -158,6 +161,13 @@ namespace love
 
         std::unordered_map<uint64_t, float> kerning;
 
+        /*
+        ** CPU copy of the newest atlas, one coverage byte per texel
+        ** New glyphs land here and go out in one copy per atlas
+        */
+        std::vector<uint8_t> atlasPixels;
+        Rect dirtyRect;
+
         void CreateTexture();
     };
 } // namespace love
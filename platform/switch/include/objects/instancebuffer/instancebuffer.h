@@ -0,0 +1,58 @@
+#pragma once
+
+#include "common/colors.h"
+#include "common/vertexc.h"
+
+#include "deko3d/CDynamicBuffer.h"
+#include "deko3d/vertex.h"
+
+#include "objects/object.h"
+#include "objects/quad/quad.h"
+
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Per-instance offsets, scales, rotations, colors and
+    ** texcoord rects for love.graphics.drawInstanced
+    */
+    class InstanceBuffer : public Object
+    {
+      public:
+        static love::Type type;
+
+        InstanceBuffer(size_t size, vertex::Usage usage);
+
+        virtual ~InstanceBuffer();
+
+        void SetInstance(size_t index, float x, float y, float angle, float sx, float sy);
+
+        void SetColor(size_t index, const Colorf& color);
+
+        void SetQuad(size_t index, Quad* quad);
+
+        const vertex::Instance& GetInstance(size_t index) const;
+
+        size_t GetCount() const;
+
+        void Flush();
+
+        /* The memory to draw from, which the current frame now reads */
+        const CMemPool::Handle& UseBuffer();
+
+      private:
+        /* CPU copy of the instances, uploaded on Flush */
+        std::vector<vertex::Instance> instances;
+
+        /* Same as Mesh, never changed under a frame drawing it */
+        CDynamicBuffer buffer;
+
+        size_t dirtyStart;
+        size_t dirtyEnd;
+
+        void CheckIndex(size_t index) const;
+
+        void MarkDirty(size_t index);
+    };
+} // namespace love
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "common/luax.h"
+#include "objects/instancebuffer/instancebuffer.h"
+
+namespace Wrap_InstanceBuffer
+{
+    int SetInstance(lua_State* L);
+
+    int GetInstance(lua_State* L);
+
+    int SetColor(lua_State* L);
+
+    int GetColor(lua_State* L);
+
+    int SetQuad(lua_State* L);
+
+    int GetCount(lua_State* L);
+
+    int Flush(lua_State* L);
+
+    love::InstanceBuffer* CheckInstanceBuffer(lua_State* L, int index);
+
+    int Register(lua_State* L);
+} // namespace Wrap_InstanceBuffer
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "common/strongref.h"
+#include "common/vertexc.h"
+
+#include "deko3d/CDynamicBuffer.h"
+#include "deko3d/vertex.h"
+
+#include "objects/drawable/drawable.h"
+#include "objects/instancebuffer/instancebuffer.h"
+#include "objects/texture/texture.h"
+
+#include <vector>
+
+namespace love
+{
+    class Graphics;
+
+    class Mesh : public Drawable
+    {
+      public:
+        enum DrawMode
+        {
+            DRAWMODE_FAN,
+            DRAWMODE_STRIP,
+            DRAWMODE_TRIANGLES,
+            DRAWMODE_POINTS,
+            DRAWMODE_MAX_ENUM
+        };
+
+        /*
+        ** User vertex formats may list the standard attributes
+        ** in any order, they are packed into vertex::Vertex
+        */
+        enum AttributeType
+        {
+            ATTRIB_POSITION,
+            ATTRIB_TEXCOORD,
+            ATTRIB_COLOR,
+            ATTRIB_MAX_ENUM
+        };
+
+        struct AttributeFormat
+        {
+            AttributeType type;
+            int components;
+        };
+
+        static love::Type type;
+
+        Mesh(const std::vector<AttributeFormat>& format,
+             const std::vector<vertex::Vertex>& vertices, DrawMode mode, vertex::Usage usage);
+
+        virtual ~Mesh();
+
+        void SetVertex(size_t index, const vertex::Vertex& vertex);
+
+        const vertex::Vertex& GetVertex(size_t index) const;
+
+        void SetVertices(size_t start, const std::vector<vertex::Vertex>& vertices);
+
+        size_t GetVertexCount() const;
+
+        const std::vector<AttributeFormat>& GetVertexFormat() const;
+
+        void SetVertexMap(const std::vector<uint32_t>& map);
+
+        void SetVertexMap();
+
+        bool GetVertexMap(std::vector<uint32_t>& map) const;
+
+        void SetTexture(Texture* texture);
+
+        void SetTexture();
+
+        Texture* GetTexture() const;
+
+        void SetDrawMode(DrawMode mode);
+
+        DrawMode GetDrawMode() const;
+
+        void SetDrawRange(int start, int count);
+
+        void SetDrawRange();
+
+        bool GetDrawRange(int& start, int& count) const;
+
+        void Flush();
+
+        void Draw(Graphics* gfx, const Matrix4& localTransform) override;
+
+        void DrawInstanced(Graphics* gfx, InstanceBuffer* instances, int count,
+                           const Matrix4& localTransform);
+
+        static std::vector<AttributeFormat> GetDefaultFormat();
+
+        static bool GetConstant(const char* in, DrawMode& out);
+        static bool GetConstant(DrawMode in, const char*& out);
+        static std::vector<const char*> GetConstants(DrawMode);
+
+        static bool GetConstant(const char* in, AttributeType& out);
+        static bool GetConstant(AttributeType in, const char*& out);
+        static std::vector<const char*> GetConstants(AttributeType);
+
+      private:
+        std::vector<AttributeFormat> format;
+
+        /* CPU copy of the vertices, uploaded on Flush */
+        std::vector<vertex::Vertex> vertices;
+
+        /* Same as SpriteBatch, never changed under a frame drawing it */
+        CDynamicBuffer buffer;
+
+        size_t dirtyStart;
+        size_t dirtyEnd;
+
+        std::vector<uint32_t> vertexMap;
+        CDynamicBuffer indexBuffer;
+        bool useVertexMap;
+
+        StrongReference<Texture> texture;
+
+        DrawMode mode;
+        vertex::Usage usage;
+
+        int rangeStart;
+        int rangeCount;
+
+        void MarkDirty(size_t start, size_t end);
+
+        void Render(Graphics* gfx, const Matrix4& localTransform, InstanceBuffer* instances,
+                    int instanceCount);
+    };
+} // namespace love
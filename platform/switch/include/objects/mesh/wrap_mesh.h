@@ -0,0 +1,46 @@
+#pragma once
+
+#include "common/luax.h"
+#include "objects/mesh/mesh.h"
+
+namespace Wrap_Mesh
+{
+    int SetVertex(lua_State* L);
+
+    int GetVertex(lua_State* L);
+
+    int SetVertices(lua_State* L);
+
+    int GetVertexCount(lua_State* L);
+
+    int GetVertexFormat(lua_State* L);
+
+    int SetVertexMap(lua_State* L);
+
+    int GetVertexMap(lua_State* L);
+
+    int SetTexture(lua_State* L);
+
+    int GetTexture(lua_State* L);
+
+    int SetDrawMode(lua_State* L);
+
+    int GetDrawMode(lua_State* L);
+
+    int SetDrawRange(lua_State* L);
+
+    int GetDrawRange(lua_State* L);
+
+    int Flush(lua_State* L);
+
+    /* Reads a vertex format table, eg { {"VertexPosition", "float", 2} } */
+    void CheckVertexFormat(lua_State* L, int index, std::vector<love::Mesh::AttributeFormat>& out);
+
+    /* Reads a table of vertex components laid out as @format */
+    vertex::Vertex CheckVertex(lua_State* L, int index,
+                               const std::vector<love::Mesh::AttributeFormat>& format);
+
+    love::Mesh* CheckMesh(lua_State* L, int index);
+
+    int Register(lua_State* L);
+} // namespace Wrap_Mesh
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "deko3d/vertex.h"
+#include "objects/particlesystem/particlesystemc.h"
+
+namespace love
+{
+    class ParticleSystem : public common::ParticleSystem
+    {
+      public:
+        ParticleSystem(Texture* texture, uint32_t size);
+
+        virtual ~ParticleSystem()
+        {}
+
+        void Draw(Graphics* gfx, const Matrix4& localTransform) override;
+
+      private:
+        /* scratch space, kept between frames to avoid allocating */
+        std::vector<Vector2> positions;
+        std::vector<vertex::Vertex> vertices;
+    };
+} // namespace love
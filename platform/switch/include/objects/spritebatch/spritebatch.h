@@ -0,0 +1,41 @@
+#pragma once
+
+#include "deko3d/CDynamicBuffer.h"
+#include "deko3d/vertex.h"
+
+#include "objects/spritebatch/spritebatchc.h"
+
+namespace love
+{
+    class SpriteBatch : public common::SpriteBatch
+    {
+      public:
+        static constexpr int VERTICES_PER_SPRITE = 4;
+
+        static constexpr uint32_t SPRITE_SIZE = VERTICES_PER_SPRITE * sizeof(vertex::Vertex);
+
+        SpriteBatch(Texture* texture, int size, vertex::Usage usage);
+
+        virtual ~SpriteBatch();
+
+        int Add(Quad* quad, const Matrix4& transform, int index = -1) override;
+
+        void Flush() override;
+
+        void Draw(Graphics* gfx, const Matrix4& localTransform) override;
+
+      private:
+        /* CPU copy of every sprite, uploaded on Flush */
+        std::vector<vertex::Vertex> vertices;
+
+        /* GPU copy, which never changes under a frame that is drawing it */
+        CDynamicBuffer buffer;
+
+        int dirtyStart;
+        int dirtyEnd;
+
+        void SetBufferSize(int newSize) override;
+
+        void MarkDirty(int start, int end);
+    };
+} // namespace love
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "deko3d/CDynamicBuffer.h"
 #include "deko3d/vertex.h"
+
 #include "objects/text/textc.h"
 
 namespace love
@@ -49,7 +51,15 @@ namespace love
 
         std::vector<TextData> textData;
 
-        std::vector<vertex::GlyphVertex> vertexBuffer;
+        /* CPU copy of the glyph quads, uploaded when they change */
+        std::vector<vertex::Vertex> vertices;
+
+        /* Uploads never overwrite the vertices of a frame the GPU is drawing */
+        CDynamicBuffer buffer;
+        bool dirty;
+
+        /* drawCommands as handed to the renderer, kept to reuse its memory */
+        std::vector<vertex::BufferRun> runs;
 
         size_t vertexOffset;
 
@@ -57,6 +67,8 @@ namespace love
 
         void CopyVertices(const std::vector<vertex::GlyphVertex>& vertices, size_t vertoffset);
 
+        void UploadVertices();
+
         void RegenerateVertices();
 
         void AddTextData(const TextData& textData);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "deko3d/CImage.h"
+#include "objects/instancebuffer/instancebuffer.h"
 #include "objects/texture/texturec.h"
 
 namespace love
@@ -22,10 +23,17 @@ namespace love
 
         void Draw(Graphics* gfx, love::Quad* quad, const Matrix4& localTransform) override;
 
+        /* Draws the whole texture once for each of the first @count @instances */
+        void DrawInstanced(Graphics* gfx, InstanceBuffer* instances, int count,
+                           const Matrix4& localTransform);
+
         bool SetWrap(const Wrap& wrap) override;
 
         void SetFilter(const Filter& filter) override;
 
+        void SetSwizzle(DkImageSwizzle red, DkImageSwizzle green, DkImageSwizzle blue,
+                        DkImageSwizzle alpha);
+
       protected:
         DkResHandle handle;
         CImage texture;
@@ -11,6 +11,9 @@ namespace love
     class BevelJoinPolyline : public Polyline
     {
       public:
+        BevelJoinPolyline(PolylineArena& arena) : Polyline(arena)
+        {}
+
         void Render(const Vector2* coords, size_t count, float halfWidth, float pixelSize,
                     bool drawOverdraw)
         {
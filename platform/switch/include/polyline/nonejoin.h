@@ -11,7 +11,7 @@ namespace love
     class NoneJoinPolyline : public Polyline
     {
       public:
-        NoneJoinPolyline() : Polyline(vertex::TriangleIndexMode::QUADS)
+        NoneJoinPolyline(PolylineArena& arena) : Polyline(arena, vertex::TriangleIndexMode::QUADS)
         {
             this->triangleMode = DkPrimitive_Quads;
         }
@@ -40,7 +40,8 @@ namespace love
         void RenderOverdraw(const std::vector<Vector2>& normals, float pixelSize,
                             bool isLooping) override;
 
-        void FillColorArray(Colorf constantColor, Colorf* colors, int count) override;
+        void FillColorArray(const vertex::Color8& constantColor, vertex::Vertex* vertices,
+                            int count) override;
 
         void RenderEdge(std::vector<Vector2>& anchors, std::vector<Vector2>& normals, Vector2& s,
                         float& lengthS, Vector2& normalS, const Vector2& q, const Vector2& r,
@@ -2,11 +2,24 @@
 
 #include "deko3d/vertex.h"
 #include <span>
+#include <vector>
 
 namespace love
 {
     class Graphics;
 
+    /*
+    ** Scratch memory shared by every line a Graphics draws
+    ** It grows to fit the longest line and keeps that capacity,
+    ** so tessellating does not allocate once it has warmed up
+    */
+    struct PolylineArena
+    {
+        std::vector<Vector2> anchors;
+        std::vector<Vector2> normals;
+        std::vector<Vector2> vertices;
+    };
+
     /*
     ** Abstract base class
     ** for a chain of segments.
@@ -14,7 +27,9 @@ namespace love
     class Polyline
     {
       public:
-        Polyline(vertex::TriangleIndexMode mode = vertex::TriangleIndexMode::STRIP) :
+        Polyline(PolylineArena& arena,
+                 vertex::TriangleIndexMode mode = vertex::TriangleIndexMode::STRIP) :
+            arena(arena),
             vertices(nullptr),
             overdraw(nullptr),
             vertexCount(0),
@@ -23,7 +38,8 @@ namespace love
             overdrawVertexStart(0)
         {}
 
-        virtual ~Polyline();
+        virtual ~Polyline()
+        {}
 
         /**
          * @param coords      Vertices defining the core line segments
@@ -46,7 +62,8 @@ namespace love
                                     bool isLooping);
 
         /* Enables a "fake" anti-aliasing line border */
-        virtual void FillColorArray(Colorf constant, Colorf* colors, int count);
+        virtual void FillColorArray(const vertex::Color8& constant, vertex::Vertex* vertices,
+                                    int count);
 
         /** Calculate line boundary points.
          *
@@ -65,6 +82,8 @@ namespace love
 
         static constexpr float LINES_PARALLEL_EPS = 0.05f;
 
+        PolylineArena& arena;
+
         Vector2* vertices;
         Vector2* overdraw;
 
@@ -0,0 +1,39 @@
+#version 460
+
+layout (location = 0) in vec2 inPos;
+layout (location = 1) in vec4 inColor;
+layout (location = 2) in vec2 inTexCoord;
+
+// per-instance attributes, see vertex::Instance
+layout (location = 3) in vec2 inOffset;
+layout (location = 4) in vec2 inScale;
+layout (location = 5) in float inRotation;
+layout (location = 6) in vec4 inInstanceColor;
+layout (location = 7) in vec4 inTexRect;
+
+// out attributes -- nothing happens if not used
+layout (location = 0) out vec4 outColor;
+layout (location = 1) out vec2 outTexCoord;
+
+layout (std140, binding = 0) uniform Transformation
+{
+    mat4 mdlvMtx;
+    mat4 projMtx;
+} u;
+
+void main()
+{
+    // a texture quad is only as big as the part of the texture it shows
+    vec2 scaled = inPos * inTexRect.zw * inScale;
+
+    float c = cos(inRotation);
+    float s = sin(inRotation);
+
+    vec2 local = inOffset + vec2(scaled.x * c - scaled.y * s, scaled.x * s + scaled.y * c);
+
+    vec4 pos = u.mdlvMtx * vec4(local, 0.0, 1.0);
+    gl_Position = u.projMtx * pos;
+
+    outColor = inColor * inInstanceColor;
+    outTexCoord = inTexRect.xy + inTexCoord * inTexRect.zw;
+}
@@ -1,8 +1,9 @@
 #version 460
 
-layout (location = 0) in vec3 inPos;
+layout (location = 0) in vec2 inPos;
 
 // in attributes -- nothing happens if not used
+// color arrives as RGBA8 unorm and is normalized by the vertex fetch
 layout (location = 1) in vec4 inColor;
 layout (location = 2) in vec2 inTexCoord;
 
@@ -18,7 +19,7 @@ layout (std140, binding = 0) uniform Transformation
 
 void main()
 {
-    vec4 pos = u.mdlvMtx * vec4(inPos, 1.0);
+    vec4 pos = u.mdlvMtx * vec4(inPos, 0.0, 1.0);
     gl_Position = u.projMtx * pos;
 
     outColor = inColor;
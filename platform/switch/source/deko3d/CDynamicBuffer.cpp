@@ -0,0 +1,130 @@
+#include "deko3d/CDynamicBuffer.h"
+#include "deko3d/deko.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    size_t GetMaxSpares(vertex::Usage usage)
+    {
+        switch (usage)
+        {
+            case vertex::USAGE_STATIC:
+                return 0;
+            case vertex::USAGE_STREAM:
+                /* enough to edit every frame the ring can have in flight */
+                return deko3d::MAX_RING_SLICES;
+            case vertex::USAGE_DYNAMIC:
+            default:
+                return 1;
+        }
+    }
+} // namespace
+
+CDynamicBuffer::CDynamicBuffer(uint32_t capacity, uint32_t alignment, vertex::Usage usage) :
+    m_current {},
+    m_spares {},
+    m_capacity { capacity },
+    m_alignment { alignment },
+    m_maxSpares { GetMaxSpares(usage) }
+{}
+
+CDynamicBuffer::~CDynamicBuffer()
+{
+    this->resize(0);
+}
+
+bool CDynamicBuffer::isIdle(const Region& region) const
+{
+    return !region.used || ::deko3d::Instance().IsFrameDone(region.lastUse);
+}
+
+void CDynamicBuffer::resize(uint32_t capacity)
+{
+    ::deko3d::Instance().Retire(m_current.memory);
+    m_current = {};
+
+    for (auto& spare : m_spares)
+        ::deko3d::Instance().Retire(spare.memory);
+
+    m_spares.clear();
+    m_capacity = capacity;
+}
+
+/* Swap the current region for one the GPU is done with */
+bool CDynamicBuffer::replace()
+{
+    auto idle = std::find_if(m_spares.begin(), m_spares.end(),
+                             [this](const Region& spare) { return this->isIdle(spare); });
+
+    Region next {};
+
+    if (idle != m_spares.end())
+    {
+        next = *idle;
+        m_spares.erase(idle);
+    }
+    else
+    {
+        next.memory = ::deko3d::Instance().GetData().allocate(m_capacity, m_alignment);
+
+        if (!next.memory)
+            return false;
+    }
+
+    if (m_current.memory)
+        m_spares.push_back(m_current);
+
+    /* more edits in flight than the usage allows for, free the oldest */
+    if (m_spares.size() > m_maxSpares)
+    {
+        ::deko3d::Instance().Retire(m_spares.front().memory);
+        m_spares.erase(m_spares.begin());
+    }
+
+    m_current      = next;
+    m_current.used = false;
+
+    return true;
+}
+
+bool CDynamicBuffer::update(const void* data, uint32_t size, uint32_t dirtyStart,
+                            uint32_t dirtyEnd)
+{
+    if (dirtyStart >= dirtyEnd)
+        return true;
+
+    char* destination = nullptr;
+
+    if (m_current.memory && this->isIdle(m_current))
+    {
+        /* nothing in flight reads it, so only what changed is copied */
+        destination = (char*)m_current.memory.getCpuAddr();
+    }
+    else
+    {
+        if (!this->replace())
+            return false;
+
+        /* the new region may hold anything, so it gets everything */
+        dirtyStart  = 0;
+        dirtyEnd    = std::max(size, dirtyEnd);
+        destination = (char*)m_current.memory.getCpuAddr();
+    }
+
+    dirtyEnd = std::min(dirtyEnd, m_capacity);
+
+    if (dirtyStart < dirtyEnd)
+        memcpy(destination + dirtyStart, (const char*)data + dirtyStart, dirtyEnd - dirtyStart);
+
+    return true;
+}
+
+const CMemPool::Handle& CDynamicBuffer::use()
+{
+    m_current.used    = true;
+    m_current.lastUse = ::deko3d::Instance().GetFrame();
+
+    return m_current.memory;
+}
@@ -8,69 +8,74 @@
 #include "common/lmath.h"
 #include "common/pixelformat.h"
 
+#include <algorithm>
 #include <cstdio>
 
+CImage::~CImage()
+{
+    // A queued copy may still target this image's memory
+    if (m_mem)
+        ::deko3d::Instance().GetUploads().sync();
+
+    m_mem.destroy();
+}
+
 bool CImage::load(love::PixelFormat pixelFormat, bool isSRGB, void* buffer, size_t size, int width,
-                  int height, bool empty)
+                  int height, bool empty, int mipmaps, bool blitMipmaps)
 {
     DkImageFormat format;
     if (!::deko3d::GetConstant(pixelFormat, format))
         return false;
 
+    /* generated levels are blitted from the one above */
+    uint32_t flags = (blitMipmaps && mipmaps > 1) ? DkImageFlags_Usage2DEngine : 0;
+
     if (!empty)
-        return this->loadMemory(::deko3d::Instance().GetImages(), ::deko3d::Instance().GetData(),
-                                ::deko3d::Instance().GetDevice(),
-                                ::deko3d::Instance().GetTextureQueue(), buffer, width, height,
-                                format);
+        return this->loadMemory(::deko3d::Instance().GetImages(), ::deko3d::Instance().GetDevice(),
+                                buffer, width, height, format, flags, mipmaps);
     else
         return this->loadEmptyPixels(::deko3d::Instance().GetImages(),
-                                     ::deko3d::Instance().GetData(),
-                                     ::deko3d::Instance().GetDevice(),
-                                     ::deko3d::Instance().GetTextureQueue(), width, height, format);
+                                     ::deko3d::Instance().GetDevice(), width, height, format,
+                                     flags, mipmaps);
 }
 
 /* replace the pixels at a location */
-bool CImage::replacePixels(CMemPool& scratchPool, dk::Device device, const void* data, size_t size,
-                           dk::Queue transferQueue, const love::Rect& rect)
+bool CImage::replacePixels(const void* data, size_t size, const love::Rect& rect)
 {
     if (data == nullptr)
         return false;
 
-    CMemPool::Handle tempImageMemory = scratchPool.allocate(size, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT);
+    return ::deko3d::Instance().BeginUpload().upload(
+        m_image, data, size,
+        { uint32_t(rect.x), uint32_t(rect.y), 0, uint32_t(rect.w), uint32_t(rect.h), 1 });
+}
 
-    if (!tempImageMemory)
+bool CImage::replaceMipmap(const void* data, size_t size, uint32_t level)
+{
+    if (data == nullptr || level >= m_mipLevels)
         return false;
 
-    memcpy(tempImageMemory.getCpuAddr(), data, size);
-
-    /*
-    ** We need to have a command buffer and some more memory for it
-    ** so allocate both and add the memory to the temporary command buffer
-    */
-    dk::UniqueCmdBuf tempCmdBuff = dk::CmdBufMaker { device }.create();
-    CMemPool::Handle tempCmdMem  = scratchPool.allocate(DK_MEMBLOCK_ALIGNMENT);
-    tempCmdBuff.addMemory(tempCmdMem.getMemBlock(), tempCmdMem.getOffset(), tempCmdMem.getSize());
+    uint32_t width  = std::max(m_width >> level, 1U);
+    uint32_t height = std::max(m_height >> level, 1U);
 
-    dk::ImageView imageView { m_image };
-    tempCmdBuff.copyBufferToImage(
-        { tempImageMemory.getGpuAddr() }, imageView,
-        { uint32_t(rect.x), uint32_t(rect.y), 0, uint32_t(rect.w), uint32_t(rect.h), 1 });
+    return ::deko3d::Instance().BeginUpload().upload(m_image, data, size,
+                                                     { 0, 0, 0, width, height, 1 }, level);
+}
 
-    // Submit the commands to the transfer queue
-    transferQueue.submitCommands(tempCmdBuff.finishList());
-    transferQueue.waitIdle();
+bool CImage::generateMipmaps()
+{
+    if (!m_mem || m_mipLevels < 2)
+        return false;
 
-    // Destroy the memory we don't need
-    tempCmdMem.destroy();
-    tempImageMemory.destroy();
+    ::deko3d::Instance().BeginUpload().generateMipmaps(m_image, m_width, m_height, m_mipLevels);
 
     return true;
 }
 
 /* load a CImage with transparent black pixels */
-bool CImage::loadEmptyPixels(CMemPool& imagePool, CMemPool& scratchPool, dk::Device device,
-                             dk::Queue transferQueue, uint32_t width, uint32_t height,
-                             DkImageFormat dkFormat, uint32_t flags)
+bool CImage::loadEmptyPixels(CMemPool& imagePool, dk::Device device, uint32_t width,
+                             uint32_t height, DkImageFormat dkFormat, uint32_t flags,
+                             uint32_t mipLevels)
 {
     PixelFormat format;
     if (!::deko3d::GetConstant(dkFormat, format))
@@ -81,29 +86,13 @@ bool CImage::loadEmptyPixels(CMemPool& imagePool, CMemPool& scratchPool, dk::Dev
     if (size <= 0)
         return false;
 
-    CMemPool::Handle tempImageMemory = scratchPool.allocate(size, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT);
-
-    if (!tempImageMemory)
-        return false;
-
-    /* memcpy for transparent black pixels */
-    std::vector<uint8_t> empty(size, 0);
-    memcpy(tempImageMemory.getCpuAddr(), empty.data(), sizeof(uint8_t) * empty.size());
-
-    /*
-    ** We need to have a command buffer and some more memory for it
-    ** so allocate both and add the memory to the temporary command buffer
-    */
-    dk::UniqueCmdBuf tempCmdBuff = dk::CmdBufMaker { device }.create();
-    CMemPool::Handle tempCmdMem  = scratchPool.allocate(DK_MEMBLOCK_ALIGNMENT);
-    tempCmdBuff.addMemory(tempCmdMem.getMemBlock(), tempCmdMem.getOffset(), tempCmdMem.getSize());
-
     // Set the image layout for the image
     dk::ImageLayout layout;
     dk::ImageLayoutMaker { device }
         .setFlags(flags)
         .setFormat(dkFormat)
         .setDimensions(width, height)
+        .setMipLevels(mipLevels)
         .initialize(layout);
 
     // Create the image
@@ -111,29 +100,22 @@ bool CImage::loadEmptyPixels(CMemPool& imagePool, CMemPool& scratchPool, dk::Dev
     m_image.initialize(layout, m_mem.getMemBlock(), m_mem.getOffset());
     m_descriptor.initialize(m_image);
 
-    dk::ImageView imageView { m_image };
-    tempCmdBuff.copyBufferToImage({ tempImageMemory.getGpuAddr() }, imageView,
-                                  { 0, 0, 0, width, height, 1 });
-
-    // Submit the commands to the transfer queue
-    transferQueue.submitCommands(tempCmdBuff.finishList());
-    transferQueue.waitIdle();
-
-    // Destroy the memory we don't need
-    tempCmdMem.destroy();
-    tempImageMemory.destroy();
+    m_width     = width;
+    m_height    = height;
+    m_mipLevels = mipLevels;
 
-    return true;
+    /* no source data stages transparent black pixels */
+    return ::deko3d::Instance().BeginUpload().upload(m_image, nullptr, size,
+                                                     { 0, 0, 0, width, height, 1 });
 }
 
-bool CImage::loadMemory(CMemPool& imagePool, CMemPool& scratchPool, dk::Device device,
-                        dk::Queue transferQueue, const void* data, uint32_t width, uint32_t height,
-                        DkImageFormat dkFormat, uint32_t flags)
+bool CImage::loadMemory(CMemPool& imagePool, dk::Device device, const void* data, uint32_t width,
+                        uint32_t height, DkImageFormat dkFormat, uint32_t flags,
+                        uint32_t mipLevels)
 {
     if (data == nullptr)
         return false;
 
-    // Allocate temporary memory for the image
     PixelFormat format;
     if (!::deko3d::GetConstant(dkFormat, format))
         return false;
@@ -143,27 +125,13 @@ bool CImage::loadMemory(CMemPool& imagePool, CMemPool& scratchPool, dk::Device d
     if (size <= 0)
         return false;
 
-    CMemPool::Handle tempImageMemory = scratchPool.allocate(size, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT);
-
-    if (!tempImageMemory)
-        return false;
-
-    memcpy(tempImageMemory.getCpuAddr(), data, size);
-
-    /*
-    ** We need to have a command buffer and some more memory for it
-    ** so allocate both and add the memory to the temporary command buffer
-    */
-    dk::UniqueCmdBuf tempCmdBuff = dk::CmdBufMaker { device }.create();
-    CMemPool::Handle tempCmdMem  = scratchPool.allocate(DK_MEMBLOCK_ALIGNMENT);
-    tempCmdBuff.addMemory(tempCmdMem.getMemBlock(), tempCmdMem.getOffset(), tempCmdMem.getSize());
-
     // Set the image layout for the image
     dk::ImageLayout layout;
     dk::ImageLayoutMaker { device }
         .setFlags(flags)
         .setFormat(dkFormat)
         .setDimensions(width, height)
+        .setMipLevels(mipLevels)
         .initialize(layout);
 
     // Create the image
@@ -171,21 +139,23 @@ bool CImage::loadMemory(CMemPool& imagePool, CMemPool& scratchPool, dk::Device d
     m_image.initialize(layout, m_mem.getMemBlock(), m_mem.getOffset());
     m_descriptor.initialize(m_image);
 
+    m_width     = width;
+    m_height    = height;
+    m_mipLevels = mipLevels;
+
     /*
-    ** Create the image's view and copy the data
-    ** to the temporary image memory
+    ** Stage the data and queue the copy into the image
+    ** It is submitted along with the other pending uploads
     */
-    dk::ImageView imageView { m_image };
-    tempCmdBuff.copyBufferToImage({ tempImageMemory.getGpuAddr() }, imageView,
-                                  { 0, 0, 0, width, height, 1 }, 0);
-
-    // Submit the commands to the transfer queue
-    transferQueue.submitCommands(tempCmdBuff.finishList());
-    transferQueue.waitIdle();
+    return ::deko3d::Instance().BeginUpload().upload(m_image, data, size,
+                                                     { 0, 0, 0, width, height, 1 });
+}
 
-    // Destroy the memory we don't need
-    tempCmdMem.destroy();
-    tempImageMemory.destroy();
+void CImage::setSwizzle(DkImageSwizzle red, DkImageSwizzle green, DkImageSwizzle blue,
+                        DkImageSwizzle alpha)
+{
+    dk::ImageView imageView { m_image };
+    imageView.setSwizzle(red, green, blue, alpha);
 
-    return true;
+    m_descriptor.initialize(imageView);
 }
@@ -149,6 +149,7 @@ auto CMemPool::allocate(uint32_t size, uint32_t alignment) -> Handle
     }
 
     slice->m_pool = this;
+    m_used += slice->getSize();
     return slice;
 
 _bad:
@@ -158,6 +159,7 @@ _bad:
 
 void CMemPool::_destroy(Slice* slice)
 {
+    m_used -= slice->getSize();
     slice->m_pool = nullptr;
 
     Slice* left  = m_memMap.prev(slice);
@@ -25,6 +25,7 @@ namespace
 
 deko3d::deko3d() :
     firstVertex(0),
+    allocator(DESCRIPTOR_COUNT),
     renderState(STATE_MAX_ENUM),
     /*
     ** Create GPU device
@@ -52,11 +53,14 @@ deko3d::deko3d() :
         this->pool.data.allocate(sizeof(this->transformState), DK_UNIFORM_BUF_ALIGNMENT);
     this->transformState.mdlvMtx = glm::mat4(1.0f);
 
-    this->descriptors.image.allocate(this->pool.data);
-    this->descriptors.sampler.allocate(this->pool.data);
+    this->descriptors.image.allocate(this->pool.data, DESCRIPTOR_COUNT);
+    this->descriptors.sampler.allocate(this->pool.data, DESCRIPTOR_COUNT);
 
-    this->cmdRing.allocate(this->pool.data, COMMAND_SIZE);
-    this->vtxRing.allocate(this->pool.data, VERTEX_COMMAND_SIZE / 2);
+    this->cmdRing.allocate(this->pool.data, COMMAND_SIZE, ringSlices);
+    this->vtxRing.allocate(this->pool.data, vertexBufferSize, ringSlices);
+
+    this->uploads.allocate(this->pool.data, this->device, this->textureQueue, UPLOAD_COMMAND_SIZE,
+                           UPLOAD_STAGING_SIZE);
 
     this->state.depthStencil.setDepthTestEnable(true);
     this->state.depthStencil.setDepthWriteEnable(true);
@@ -82,6 +86,11 @@ deko3d::deko3d() :
 
 deko3d::~deko3d()
 {
+    this->queue.waitIdle();
+
+    for (auto& entry : this->frames.retired)
+        entry.second.destroy();
+
     this->DestroyFramebufferResources();
     this->transformUniformBuffer.destroy();
 }
@@ -92,6 +101,16 @@ deko3d& deko3d::Instance()
     return instance;
 }
 
+void deko3d::SetVertexBufferSize(size_t size)
+{
+    deko3d::vertexBufferSize = std::max(size, sizeof(vertex::Vertex) * 0x400);
+}
+
+void deko3d::SetRingSliceCount(unsigned count)
+{
+    deko3d::ringSlices = std::clamp(count, 2U, MAX_RING_SLICES);
+}
+
 void deko3d::CreateFramebufferResources()
 {
     /* initialize depth buffer */
@@ -157,8 +176,13 @@ void deko3d::DestroyFramebufferResources()
 
     this->textureQueue.waitIdle();
 
-    // Clear the cmdbuf
+    // Clear the cmdbuf, dropping anything still batched
     this->cmdBuf.clear();
+    this->batch.count = 0;
+
+    // The binds we cached went with it, so record them all again
+    this->bound               = {};
+    this->bound.pipelineDirty = true;
 
     // Destroy the swapchain
     this->swapchain.destroy();
@@ -178,31 +202,124 @@ void deko3d::EnsureInFrame()
         this->firstVertex      = 0;
         this->descriptorsDirty = false;
         this->cmdRing.begin(this->cmdBuf);
+
+        /* the fence just waited on was signalled by the last frame to use this slice */
+        const unsigned slices = this->cmdRing.getSliceCount();
+
+        if (this->frames.current >= slices)
+            this->frames.completed = this->frames.current - slices + 1;
+
+        this->ReleaseRetired();
+
         this->framebuffers.inFrame = true;
     }
 }
 
-void deko3d::EnsureInState(State state)
+CUploadRing<deko3d::MAX_FRAMEBUFFERS>& deko3d::BeginUpload()
 {
-    if (this->renderState != state && state != State::STATE_MAX_ENUM)
-        this->renderState = state;
+    if (this->framebuffers.inFrame)
+    {
+        this->FlushBatch();
+
+        /* the draws so far go out first, with the uploads they come after */
+        if (this->stats.drawCalls != this->uploadOrder.drawCalls)
+        {
+            this->uploads.waitOn(this->queue);
 
-    if (this->renderState == STATE_PRIMITIVE)
+            this->cmdBuf.signalFence(this->uploadOrder.rendered);
+            this->queue.submitCommands(this->cmdBuf.finishList());
+            this->queue.flush();
+
+            this->uploadOrder.waited    = false;
+            this->uploadOrder.drawCalls = this->stats.drawCalls;
+        }
+    }
+
+    if (!this->uploadOrder.waited)
     {
-        love::Shader::standardShaders[love::Shader::STANDARD_DEFAULT]->Attach();
+        this->uploads.waitFor(this->uploadOrder.rendered);
+        this->uploadOrder.waited = true;
+    }
+
+    return this->uploads;
+}
+
+void deko3d::Retire(CMemPool::Handle memory)
+{
+    if (memory)
+        this->frames.retired.emplace_back(this->frames.current, memory);
+}
+
+void deko3d::ReleaseRetired()
+{
+    auto& retired = this->frames.retired;
+
+    auto done = std::find_if(retired.begin(), retired.end(), [this](const auto& entry) {
+        return !this->IsFrameDone(entry.first);
+    });
+
+    for (auto it = retired.begin(); it != done; ++it)
+        it->second.destroy();
+
+    retired.erase(retired.begin(), done);
+}
 
-        this->cmdBuf.bindVtxAttribState(vertex::attributes::PrimitiveAttribState);
-        this->cmdBuf.bindVtxBufferState(vertex::attributes::PrimitiveBufferState);
+/* Textures and video share a vertex format, so switching between them keeps it bound */
+template<size_t Attribs, size_t Buffers>
+void deko3d::BindVertexFormat(const std::array<DkVtxAttribState, Attribs>& attribs,
+                              const std::array<DkVtxBufferState, Buffers>& buffers)
+{
+    if (this->bound.attributes == attribs.data())
+    {
+        this->stats.skippedBinds++;
+        return;
     }
-    else if (this->renderState == STATE_TEXTURE || this->renderState == STATE_VIDEO)
+
+    this->cmdBuf.bindVtxAttribState(attribs);
+    this->cmdBuf.bindVtxBufferState(buffers);
+
+    this->bound.attributes = attribs.data();
+}
+
+void deko3d::EnsureInState(State state)
+{
+    if (this->renderState != state && state != State::STATE_MAX_ENUM)
+        this->renderState = state;
+
+    switch (this->renderState)
     {
-        if (this->renderState == STATE_TEXTURE)
+        case STATE_PRIMITIVE:
+            love::Shader::standardShaders[love::Shader::STANDARD_DEFAULT]->Attach();
+            this->BindVertexFormat(vertex::attributes::PrimitiveAttribState,
+                                   vertex::attributes::PrimitiveBufferState);
+            break;
+        case STATE_TEXTURE:
             love::Shader::standardShaders[love::Shader::STANDARD_TEXTURE]->Attach();
-        else
+            this->BindVertexFormat(vertex::attributes::TextureAttribState,
+                                   vertex::attributes::TextureBufferState);
+            break;
+        case STATE_VIDEO:
             love::Shader::standardShaders[love::Shader::STANDARD_VIDEO]->Attach();
-
-        this->cmdBuf.bindVtxAttribState(vertex::attributes::TextureAttribState);
-        this->cmdBuf.bindVtxBufferState(vertex::attributes::TextureBufferState);
+            this->BindVertexFormat(vertex::attributes::TextureAttribState,
+                                   vertex::attributes::TextureBufferState);
+            break;
+        case STATE_INSTANCED:
+            love::Shader::standardShaders[love::Shader::STANDARD_INSTANCED]->Attach();
+            this->BindVertexFormat(vertex::attributes::InstanceAttribState,
+                                   vertex::attributes::InstanceBufferState);
+            break;
+        case STATE_INSTANCED_TEXTURE:
+            love::Shader::standardShaders[love::Shader::STANDARD_INSTANCED_TEXTURE]->Attach();
+            this->BindVertexFormat(vertex::attributes::InstanceAttribState,
+                                   vertex::attributes::InstanceBufferState);
+            break;
+        case STATE_INSTANCED_QUAD:
+            love::Shader::standardShaders[love::Shader::STANDARD_INSTANCED_QUAD]->Attach();
+            this->BindVertexFormat(vertex::attributes::InstanceAttribState,
+                                   vertex::attributes::InstanceBufferState);
+            break;
+        default:
+            break;
     }
 }
 
@@ -218,6 +335,7 @@ void deko3d::EnsureHasSlot()
 
 void deko3d::SetBlendColor(const Colorf& color)
 {
+    this->FlushBatch();
     this->cmdBuf.setBlendConst(color.r, color.g, color.b, color.a);
 }
 
@@ -228,6 +346,7 @@ void deko3d::SetBlendColor(const Colorf& color)
 void deko3d::ClearColor(const Colorf& color)
 {
     this->EnsureInFrame();
+    this->FlushBatch();
 
     this->cmdBuf.clearColor(0, DkColorMask_RGBA, color.r, color.g, color.b, color.a);
 }
@@ -240,6 +359,8 @@ void deko3d::ClearDepthStencil(double depth, int stencil)
 void deko3d::SetDekoBarrier(DkBarrier barrier, uint32_t flags)
 {
     this->EnsureInFrame();
+    this->FlushBatch();
+
     this->cmdBuf.barrier(barrier, flags);
 }
 
@@ -257,9 +378,20 @@ void deko3d::BindFramebuffer(love::Canvas* canvas)
     this->EnsureInFrame();
     this->EnsureHasSlot();
 
-    if (this->framebuffers.dirty)
-        this->SetDekoBarrier(DkBarrier_Fragments, 0);
+    /* rebinding the current target would only split the batch */
+    if (this->framebuffers.target == canvas)
+    {
+        this->stats.skippedBinds++;
+        return;
+    }
 
+    this->FlushBatch();
+    this->stats.canvasSwitches++;
+
+    /*
+    ** No barrier here: switching targets doesn't need one, only
+    ** sampling a canvas that was rendered to does (see BindTextures)
+    */
     dk::ImageView target { this->framebuffers.images[this->framebuffers.slot] };
 
     if (canvas != nullptr)
@@ -267,19 +399,15 @@ void deko3d::BindFramebuffer(love::Canvas* canvas)
         target = { canvas->GetImage() };
         this->SetViewport({ 0, 0, canvas->GetWidth(), canvas->GetHeight() });
 
-        this->framebuffers.dirty = true;
+        this->MarkCanvasWritten(canvas);
     }
     else
-    {
-        this->framebuffers.dirty = false;
         this->SetViewport({ 0, 0, this->viewport.w, this->viewport.h });
-    }
 
     this->cmdBuf.bindRenderTargets(&target);
+    this->framebuffers.target = canvas;
 
-    this->cmdBuf.pushConstants(this->transformUniformBuffer.getGpuAddr(),
-                               this->transformUniformBuffer.getSize(), 0, sizeof(transformState),
-                               &transformState);
+    this->PushTransformation();
 
     this->BeginFrame();
 }
@@ -288,7 +416,26 @@ void deko3d::BeginFrame()
 {
     std::pair<void*, DkGpuAddr> data = this->vtxRing.begin();
 
-    this->vertexData = (vertex::Vertex*)data.first;
+    this->vertexData     = (vertex::Vertex*)data.first;
+    this->vertexDataAddr = data.second;
+
+    if (this->bound.pipelineDirty)
+        this->BindPipelineState();
+    else
+        this->stats.skippedBinds++;
+
+    // Bind the current slice's GPU address to the buffer
+    this->BindVertexBuffer(data.second, this->vtxRing.getSize());
+}
+
+/* Records the blend, rasterizer and color state, if we are in a frame */
+void deko3d::BindPipelineState()
+{
+    if (!this->framebuffers.inFrame)
+    {
+        this->bound.pipelineDirty = true;
+        return;
+    }
 
     this->cmdBuf.bindRasterizerState(this->state.rasterizer);
     this->cmdBuf.bindColorState(this->state.color);
@@ -296,8 +443,100 @@ void deko3d::BeginFrame()
     this->cmdBuf.bindBlendStates(0, this->state.blendState);
     // this->cmdBuf.bindDepthStencilState(this->state.depthStencil);
 
-    // Bind the current slice's GPU address to the buffer
-    this->cmdBuf.bindVtxBuffer(0, data.second, this->vtxRing.getSize());
+    this->bound.pipelineDirty = false;
+}
+
+void deko3d::BindVertexBuffer(DkGpuAddr address, uint32_t size)
+{
+    if (this->bound.vertexBuffer == address && this->bound.vertexBufferSize == size)
+    {
+        this->stats.skippedBinds++;
+        return;
+    }
+
+    this->cmdBuf.bindVtxBuffer(0, address, size);
+
+    this->bound.vertexBuffer     = address;
+    this->bound.vertexBufferSize = size;
+}
+
+void deko3d::MarkCanvasWritten(love::Canvas* canvas)
+{
+    auto& written = this->framebuffers.written;
+
+    if (std::find(written.begin(), written.end(), canvas->GetHandle()) == written.end())
+        written.push_back(canvas->GetHandle());
+}
+
+/*
+** Waits for earlier rendering before sampling from any canvas it
+** touched. One barrier covers every canvas written so far, so a
+** chain of post-processing passes only waits once per read-back
+*/
+void deko3d::ResolveCanvasWrites(const DkResHandle* handles, size_t count)
+{
+    auto& written = this->framebuffers.written;
+
+    auto isWritten = [&written](DkResHandle handle) {
+        return std::find(written.begin(), written.end(), handle) != written.end();
+    };
+
+    if (written.empty() || std::none_of(handles, handles + count, isWritten))
+        return;
+
+    this->cmdBuf.barrier(DkBarrier_Fragments, DkInvalidateFlags_Image);
+    written.clear();
+
+    /* whatever is drawn to the current target from now on is not covered */
+    if (this->framebuffers.target.value_or(nullptr) != nullptr)
+        this->MarkCanvasWritten(*this->framebuffers.target);
+}
+
+void deko3d::BindTextures(const DkResHandle* handles, size_t count)
+{
+    if (this->descriptorsDirty)
+    {
+        this->cmdBuf.barrier(DkBarrier_Primitives, DkInvalidateFlags_Descriptors);
+        this->descriptorsDirty = false;
+    }
+
+    /* checked even when the handles are bound already, their contents may not be current */
+    this->ResolveCanvasWrites(handles, count);
+
+    if (this->bound.textureCount == count &&
+        std::equal(handles, handles + count, this->bound.textures))
+    {
+        this->stats.skippedBinds++;
+        return;
+    }
+
+    if (count == 1)
+        this->cmdBuf.bindTextures(DkStage_Fragment, 0, handles[0]);
+    else
+        this->cmdBuf.bindTextures(DkStage_Fragment, 0, { handles[0], handles[1], handles[2] });
+
+    std::copy(handles, handles + count, this->bound.textures);
+    this->bound.textureCount = count;
+
+    this->stats.textureBinds++;
+}
+
+/* Uploads the transformation uniforms, unless the GPU already has them */
+void deko3d::PushTransformation()
+{
+    const auto& bound = this->bound.transform;
+
+    if (bound && memcmp(&*bound, &this->transformState, sizeof(Transformation)) == 0)
+    {
+        this->stats.skippedBinds++;
+        return;
+    }
+
+    this->cmdBuf.pushConstants(this->transformUniformBuffer.getGpuAddr(),
+                               this->transformUniformBuffer.getSize(), 0, sizeof(Transformation),
+                               &this->transformState);
+
+    this->bound.transform = this->transformState;
 }
 
 /*
@@ -312,18 +551,70 @@ void deko3d::Present()
 
     if (this->framebuffers.inFrame)
     {
-        this->vtxRing.end();
+        this->FlushBatch();
+
+        this->stats.vertexHighWater =
+            std::max(this->stats.vertexHighWater, this->stats.ringVertices);
+
+        this->vtxRing.end(this->cmdBuf);
+
+        /* Textures uploaded since the last split land before the rest of the frame */
+        this->uploads.waitOn(this->queue);
+
+        this->cmdBuf.signalFence(this->uploadOrder.rendered);
+        this->uploadOrder.waited    = false;
+        this->uploadOrder.drawCalls = 0;
+
         this->queue.submitCommands(this->cmdRing.end(this->cmdBuf));
         this->queue.presentImage(this->swapchain, this->framebuffers.slot);
 
+        this->frames.current++;
+
         this->framebuffers.inFrame = false;
     }
 
     this->framebuffers.slot = -1;
+    this->framebuffers.target.reset();
+
+    this->stats.drawCalls        = 0;
+    this->stats.drawCallsBatched = 0;
+    this->stats.canvasSwitches   = 0;
+    this->stats.shaderSwitches   = 0;
+    this->stats.textureBinds     = 0;
+    this->stats.vertices         = 0;
+    this->stats.skippedBinds     = 0;
+    this->stats.ringVertices     = 0;
+}
+
+void deko3d::GetStats(love::Graphics::Stats& stats) const
+{
+    stats.drawCalls        = this->stats.drawCalls;
+    stats.drawCallsBatched = this->stats.drawCallsBatched;
+    stats.canvasSwitches   = this->stats.canvasSwitches;
+    stats.shaderSwitches   = this->stats.shaderSwitches;
+    stats.textureBinds     = this->stats.textureBinds;
+    stats.vertices         = this->stats.vertices;
+    stats.skippedBinds     = this->stats.skippedBinds;
+
+    /* every flushed batch records exactly one draw */
+    stats.flushes = this->stats.drawCalls;
+
+    stats.vertexHighWater = this->stats.vertexHighWater;
+
+    /* deko3d has no way to ask how much of a command buffer was written */
+    stats.commandHighWater = 0;
+
+    stats.descriptors = this->allocator.GetCount();
+
+    stats.pools = { { "images", this->pool.images.getUsed() },
+                    { "data", this->pool.data.getUsed() },
+                    { "code", this->pool.code.getUsed() } };
 }
 
 void deko3d::SetStencil(DkStencilOp op, DkCompareOp compare, int value)
 {
+    this->FlushBatch();
+
     bool enabled = (compare == DkCompareOp_Always) ? false : true;
 
     this->state.depthStencil.setStencilTestEnable(enabled);
@@ -355,8 +646,15 @@ void deko3d::UnRegisterResHandle(DkResHandle handle)
 DkResHandle deko3d::RegisterResHandle(const dk::ImageDescriptor& descriptor)
 {
     this->EnsureInFrame();
+    this->FlushBatch();
+
+    size_t index = 0;
 
-    uint32_t index = this->allocator.Allocate();
+    if (!this->allocator.Allocate(index))
+    {
+        this->GrowDescriptors();
+        this->allocator.Allocate(index);
+    }
 
     this->descriptors.image.update(this->cmdBuf, index, descriptor);
     this->descriptors.sampler.update(this->cmdBuf, index, this->filter.descriptor);
@@ -366,117 +664,385 @@ DkResHandle deko3d::RegisterResHandle(const dk::ImageDescriptor& descriptor)
     return dkMakeTextureHandle(index, index);
 }
 
-bool deko3d::RenderTexture(const DkResHandle handle, const vertex::Vertex* points, size_t count)
+/*
+** Double the image and sampler descriptor sets
+** Existing handles keep their indices, so nothing else changes
+*/
+void deko3d::GrowDescriptors()
+{
+    size_t capacity = this->allocator.GetCapacity();
+
+    if (capacity >= MAX_DESCRIPTORS)
+        throw love::Exception("Cannot have more than %zu textures at once.", MAX_DESCRIPTORS);
+
+    size_t newCapacity = std::min(capacity * 2, MAX_DESCRIPTORS);
+
+    CMemPool::Handle image, sampler;
+
+    if (!this->descriptors.image.grow(this->pool.data, this->cmdBuf, newCapacity, image))
+        throw love::Exception("Failed to grow the texture descriptor sets.");
+
+    this->Retire(image);
+
+    if (!this->descriptors.sampler.grow(this->pool.data, this->cmdBuf, newCapacity, sampler))
+        throw love::Exception("Failed to grow the texture descriptor sets.");
+
+    this->Retire(sampler);
+
+    /* the copies have to land before new descriptors are pushed on top */
+    this->cmdBuf.barrier(DkBarrier_Full, DkInvalidateFlags_Descriptors);
+
+    this->descriptors.image.bindForImages(this->cmdBuf);
+    this->descriptors.sampler.bindForSamplers(this->cmdBuf);
+
+    this->allocator.Reserve(newCapacity);
+}
+
+void deko3d::UpdateResHandle(DkResHandle handle, const dk::ImageDescriptor& descriptor)
+{
+    this->EnsureInFrame();
+    this->FlushBatch();
+
+    uint32_t index = this->allocator.Find(handle);
+    this->descriptors.image.update(this->cmdBuf, index, descriptor);
+
+    this->descriptorsDirty = true;
+}
+
+/*
+** Only primitives where every primitive owns its vertices
+** can be merged, strips and fans would connect to the
+** previous draw's vertices
+*/
+static bool IsBatchable(DkPrimitive mode)
 {
-    if (count > (this->vtxRing.getSize() - this->firstVertex) || points == nullptr)
+    switch (mode)
+    {
+        case DkPrimitive_Points:
+        case DkPrimitive_Lines:
+        case DkPrimitive_Triangles:
+        case DkPrimitive_Quads:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool deko3d::CanMergeBatch(State state, DkPrimitive mode, const DkResHandle* handles,
+                           size_t handleCount, const glm::mat4& transform)
+{
+    if (this->batch.count == 0 || this->batch.state != state || this->batch.mode != mode)
         return false;
 
-    this->EnsureInState(STATE_TEXTURE);
+    if (!IsBatchable(mode) || this->batch.handleCount != handleCount)
+        return false;
 
-    if (this->descriptorsDirty)
+    for (size_t index = 0; index < handleCount; index++)
     {
-        this->cmdBuf.barrier(DkBarrier_Primitives, DkInvalidateFlags_Descriptors);
-        this->descriptorsDirty = false;
+        if (this->batch.handles[index] != handles[index])
+            return false;
     }
 
-    this->cmdBuf.bindTextures(DkStage_Fragment, 0, handle);
+    return this->batch.transform == transform;
+}
 
-    memcpy(this->vertexData + this->firstVertex, points, count * sizeof(vertex::Vertex));
+/*
+** Reserve @count vertices at the end of the current batch
+** If the state differs, the pending batch is flushed first
+** and a new one is started
+*/
+vertex::Vertex* deko3d::PrepareBatch(State state, DkPrimitive mode, const DkResHandle* handles,
+                                     size_t handleCount, size_t count,
+                                     const love::Matrix4& transform)
+{
+    glm::mat4 modelView = glm::make_mat4(transform.GetElements());
 
-    this->cmdBuf.draw(DkPrimitive_Quads, count, 1, this->firstVertex, 0);
+    size_t capacity = this->vtxRing.getSize() / sizeof(vertex::Vertex);
+
+    if (count > (capacity - this->firstVertex))
+    {
+        /* out of room: draw what we have and continue in a fresh buffer */
+        this->FlushBatch();
 
+        if (!this->SpillVertices(count))
+            return nullptr;
+    }
+
+    if (!this->CanMergeBatch(state, mode, handles, handleCount, modelView))
+    {
+        this->FlushBatch();
+
+        this->EnsureInState(state);
+
+        this->batch.state       = state;
+        this->batch.mode        = mode;
+        this->batch.handleCount = handleCount;
+
+        for (size_t index = 0; index < handleCount; index++)
+            this->batch.handles[index] = handles[index];
+
+        this->batch.transform = modelView;
+        this->batch.first = this->firstVertex;
+    }
+    else
+        this->stats.drawCallsBatched++;
+
+    vertex::Vertex* vertices = this->vertexData + this->firstVertex;
+
+    this->batch.count += count;
     this->firstVertex += count;
 
+    this->stats.vertices += count;
+    this->stats.ringVertices += count;
+
+    return vertices;
+}
+
+/*
+** Chain another buffer of at least @count vertices onto
+** the vertex ring for the rest of this frame
+*/
+bool deko3d::SpillVertices(size_t count)
+{
+    if (!this->vtxRing.spill(count * sizeof(vertex::Vertex)))
+        return false;
+
+    std::pair<void*, DkGpuAddr> data = this->vtxRing.begin();
+
+    this->vertexData     = (vertex::Vertex*)data.first;
+    this->vertexDataAddr = data.second;
+    this->firstVertex    = 0;
+
+    this->BindVertexBuffer(data.second, this->vtxRing.getSize());
+
     return true;
 }
 
-bool deko3d::RenderVideo(const DkResHandle handles[3], const vertex::Vertex* points, size_t count)
+/*
+** Records the pending batch as a single draw call
+** This must happen before anything that changes the state
+** the batch was built with
+*/
+void deko3d::FlushBatch()
 {
-    if (count > (this->vtxRing.getSize() - this->firstVertex) || points == nullptr)
+    if (this->batch.count == 0)
+        return;
+
+    if (this->batch.handleCount > 0)
+        this->BindTextures(this->batch.handles, this->batch.handleCount);
+
+    this->SetModelViewMatrix(this->batch.transform);
+
+    this->cmdBuf.draw(this->batch.mode, this->batch.count, 1, this->batch.first, 0);
+    this->stats.drawCalls++;
+
+    this->batch.count = 0;
+}
+
+bool deko3d::RenderTexture(const DkResHandle handle, const vertex::Vertex* points, size_t count,
+                           const love::Matrix4& transform)
+{
+    if (points == nullptr)
         return false;
 
-    this->EnsureInState(STATE_VIDEO);
+    vertex::Vertex* vertices =
+        this->PrepareBatch(STATE_TEXTURE, DkPrimitive_Quads, &handle, 1, count, transform);
 
-    if (this->descriptorsDirty)
-    {
-        this->cmdBuf.barrier(DkBarrier_Primitives, DkInvalidateFlags_Descriptors);
-        this->descriptorsDirty = false;
-    }
+    if (vertices == nullptr)
+        return false;
 
-    this->cmdBuf.bindTextures(DkStage_Fragment, 0, { handles[0], handles[1], handles[2] });
+    memcpy(vertices, points, count * sizeof(vertex::Vertex));
 
-    memcpy(this->vertexData + this->firstVertex, points, count * sizeof(vertex::Vertex));
+    return true;
+}
 
-    this->cmdBuf.draw(DkPrimitive_Quads, count, 1, this->firstVertex, 0);
+bool deko3d::RenderVideo(const DkResHandle handles[3], const vertex::Vertex* points, size_t count,
+                         const love::Matrix4& transform)
+{
+    if (points == nullptr)
+        return false;
 
-    this->firstVertex += count;
+    vertex::Vertex* vertices =
+        this->PrepareBatch(STATE_VIDEO, DkPrimitive_Quads, handles, 3, count, transform);
+
+    if (vertices == nullptr)
+        return false;
+
+    memcpy(vertices, points, count * sizeof(vertex::Vertex));
 
     return true;
 }
 
-bool deko3d::RenderPolyline(DkPrimitive mode, const vertex::Vertex* points, size_t count)
+vertex::Vertex* deko3d::ReserveVertices(DkPrimitive mode, size_t count,
+                                        const love::Matrix4& transform)
+{
+    vertex::Vertex* vertices =
+        this->PrepareBatch(STATE_PRIMITIVE, mode, nullptr, 0, count, transform);
+
+    this->reserved = (vertices != nullptr) ? count : 0;
+
+    return vertices;
+}
+
+void deko3d::CommitVertices(size_t count)
 {
-    if (count > (this->vtxRing.getSize() - this->firstVertex) || points == nullptr)
+    /* give back what was reserved but never written */
+    uint32_t unused = this->reserved - std::min(count, this->reserved);
+
+    this->batch.count -= unused;
+    this->firstVertex -= unused;
+
+    this->stats.vertices -= unused;
+    this->stats.ringVertices -= unused;
+
+    this->reserved = 0;
+
+    if (!IsBatchable(this->batch.mode))
+        this->FlushBatch();
+}
+
+/*
+** Sets up the state for a draw that does not go through the
+** batch and returns how many instances it should be drawn with
+*/
+uint32_t deko3d::PrepareDraw(const DkResHandle* handle, const love::Matrix4& transform,
+                             const Instances* instances, State state)
+{
+    this->EnsureInFrame();
+    this->FlushBatch();
+
+    if (state != STATE_MAX_ENUM)
+        this->EnsureInState(state);
+    else if (instances != nullptr)
+        this->EnsureInState((handle != nullptr) ? STATE_INSTANCED_TEXTURE : STATE_INSTANCED);
+    else
+        this->EnsureInState((handle != nullptr) ? STATE_TEXTURE : STATE_PRIMITIVE);
+
+    if (handle != nullptr)
+        this->BindTextures(handle, 1);
+
+    this->SetModelViewMatrix(glm::make_mat4(transform.GetElements()));
+
+    if (instances == nullptr)
+        return 1;
+
+    this->cmdBuf.bindVtxBuffer(1, instances->buffer->getGpuAddr(), instances->buffer->getSize());
+
+    return instances->count;
+}
+
+bool deko3d::RenderBuffer(DkPrimitive mode, const DkResHandle* handle,
+                          const CMemPool::Handle& buffer, uint32_t first, uint32_t count,
+                          const love::Matrix4& transform, const CMemPool::Handle* indices,
+                          uint32_t baseVertex, const Instances* instances)
+{
+    if (count == 0 || !buffer)
         return false;
 
-    this->EnsureInState(STATE_PRIMITIVE);
+    if (instances != nullptr && (instances->count == 0 || !*instances->buffer))
+        return false;
 
-    memcpy(this->vertexData + this->firstVertex, points, count * sizeof(vertex::Vertex));
+    uint32_t instanceCount = this->PrepareDraw(handle, transform, instances);
+    uint32_t firstInstance = (instances != nullptr) ? instances->first : 0;
 
-    this->cmdBuf.draw(mode, count, 1, this->firstVertex, 0);
+    this->BindVertexBuffer(buffer.getGpuAddr(), buffer.getSize());
 
-    this->firstVertex += count;
+    if (indices != nullptr)
+    {
+        this->cmdBuf.bindIdxBuffer(DkIdxFormat_Uint32, indices->getGpuAddr());
+        this->cmdBuf.drawIndexed(mode, count, instanceCount, first, baseVertex, firstInstance);
+    }
+    else
+        this->cmdBuf.draw(mode, count, instanceCount, first + baseVertex, firstInstance);
+
+    this->stats.drawCalls++;
+    this->stats.vertices += count * instanceCount;
+
+    /* go back to the vertex ring for everything else */
+    this->BindVertexBuffer(this->vertexDataAddr, this->vtxRing.getSize());
 
     return true;
 }
 
-bool deko3d::RenderPolygon(const vertex::Vertex* points, size_t count)
+bool deko3d::RenderBufferRuns(DkPrimitive mode, const CMemPool::Handle& buffer,
+                              std::span<const vertex::BufferRun> runs,
+                              const love::Matrix4& transform)
 {
-    if (count > (this->vtxRing.getSize() - this->firstVertex) || points == nullptr)
+    if (runs.empty() || !buffer)
         return false;
 
-    this->EnsureInState(STATE_PRIMITIVE);
+    this->PrepareDraw(&runs.front().handle, transform, nullptr);
+    this->BindVertexBuffer(buffer.getGpuAddr(), buffer.getSize());
 
-    memcpy(this->vertexData + this->firstVertex, points, count * sizeof(vertex::Vertex));
+    for (const auto& run : runs)
+    {
+        this->BindTextures(&run.handle, 1);
+        this->cmdBuf.draw(mode, run.count, 1, run.first, 0);
 
-    this->cmdBuf.draw(DkPrimitive_TriangleFan, count, 1, this->firstVertex, 0);
+        this->stats.drawCalls++;
+        this->stats.vertices += run.count;
+    }
 
-    this->firstVertex += count;
+    this->BindVertexBuffer(this->vertexDataAddr, this->vtxRing.getSize());
 
     return true;
 }
 
-bool deko3d::RenderPoints(const vertex::Vertex* points, size_t count)
+bool deko3d::RenderInstanced(DkPrimitive mode, const DkResHandle* handle,
+                             const vertex::Vertex* points, size_t count,
+                             const love::Matrix4& transform, const Instances& instances)
 {
-    if (count > (this->vtxRing.getSize() - this->firstVertex) || points == nullptr)
+    if (points == nullptr || count == 0 || instances.count == 0 || !*instances.buffer)
         return false;
 
-    this->EnsureInState(STATE_PRIMITIVE);
+    this->PrepareDraw(handle, transform, &instances, STATE_INSTANCED_QUAD);
+
+    size_t capacity = this->vtxRing.getSize() / sizeof(vertex::Vertex);
+
+    if (count > (capacity - this->firstVertex) && !this->SpillVertices(count))
+        return false;
 
     memcpy(this->vertexData + this->firstVertex, points, count * sizeof(vertex::Vertex));
 
-    this->cmdBuf.draw(DkPrimitive_Points, count, 1, this->firstVertex, 0);
+    this->cmdBuf.draw(mode, count, instances.count, this->firstVertex, instances.first);
 
     this->firstVertex += count;
 
+    this->stats.drawCalls++;
+    this->stats.vertices += count * instances.count;
+    this->stats.ringVertices += count;
+
     return true;
 }
 
+void deko3d::SetModelViewMatrix(const glm::mat4& matrix)
+{
+    this->transformState.mdlvMtx = matrix;
+    this->PushTransformation();
+}
+
 void deko3d::SetPointSize(float size)
 {
     this->EnsureInFrame();
+    this->FlushBatch();
+
     this->cmdBuf.setPointSize(size);
 }
 
 void deko3d::SetLineWidth(float width)
 {
     this->EnsureInFrame();
+    this->FlushBatch();
+
     this->cmdBuf.setLineWidth(width);
 }
 
 void deko3d::SetLineStyle(bool smooth)
 {
-    this->state.rasterizer.setPolygonSmoothEnable(smooth);
+    dk::RasterizerState rasterizer = this->state.rasterizer;
+    rasterizer.setPolygonSmoothEnable(smooth);
+
+    this->SetRasterizerState(rasterizer);
 }
 
 float deko3d::GetPointSize()
@@ -486,31 +1052,85 @@ float deko3d::GetPointSize()
 
 void deko3d::SetColorMask(const love::Graphics::ColorMask& mask)
 {
-    this->state.colorWrite.setMask(0, mask.GetColorMask());
+    dk::ColorWriteState colorWrite = this->state.colorWrite;
+    colorWrite.setMask(0, mask.GetColorMask());
+
+    if (memcmp(&colorWrite, &this->state.colorWrite, sizeof(dk::ColorWriteState)) == 0)
+    {
+        this->stats.skippedBinds++;
+        return;
+    }
+
+    this->FlushBatch();
+    this->state.colorWrite = colorWrite;
+
+    if (this->framebuffers.inFrame)
+        this->cmdBuf.bindColorWriteState(this->state.colorWrite);
+    else
+        this->bound.pipelineDirty = true;
 }
 
 void deko3d::SetBlendMode(DkBlendOp func, DkBlendFactor srcColor, DkBlendFactor srcAlpha,
                           DkBlendFactor dstColor, DkBlendFactor dstAlpha)
 {
-    this->state.blendState.setColorBlendOp(func);
-    this->state.blendState.setAlphaBlendOp(func);
+    dk::BlendState blendState = this->state.blendState;
+
+    blendState.setColorBlendOp(func);
+    blendState.setAlphaBlendOp(func);
 
     // Blend factors
-    this->state.blendState.setSrcColorBlendFactor(srcColor);
-    this->state.blendState.setSrcAlphaBlendFactor(srcAlpha);
+    blendState.setSrcColorBlendFactor(srcColor);
+    blendState.setSrcAlphaBlendFactor(srcAlpha);
+
+    blendState.setDstColorBlendFactor(dstColor);
+    blendState.setDstAlphaBlendFactor(dstAlpha);
+
+    if (memcmp(&blendState, &this->state.blendState, sizeof(dk::BlendState)) == 0)
+    {
+        this->stats.skippedBinds++;
+        return;
+    }
+
+    this->FlushBatch();
+    this->state.blendState = blendState;
 
-    this->state.blendState.setDstColorBlendFactor(dstColor);
-    this->state.blendState.setDstAlphaBlendFactor(dstAlpha);
+    if (this->framebuffers.inFrame)
+        this->cmdBuf.bindBlendStates(0, this->state.blendState);
+    else
+        this->bound.pipelineDirty = true;
 }
 
 void deko3d::SetFrontFaceWinding(DkFrontFace face)
 {
-    this->state.rasterizer.setFrontFace(face);
+    dk::RasterizerState rasterizer = this->state.rasterizer;
+    rasterizer.setFrontFace(face);
+
+    this->SetRasterizerState(rasterizer);
 }
 
 void deko3d::SetCullMode(DkFace face)
 {
-    this->state.rasterizer.setCullMode(face);
+    dk::RasterizerState rasterizer = this->state.rasterizer;
+    rasterizer.setCullMode(face);
+
+    this->SetRasterizerState(rasterizer);
+}
+
+void deko3d::SetRasterizerState(const dk::RasterizerState& rasterizer)
+{
+    if (memcmp(&rasterizer, &this->state.rasterizer, sizeof(dk::RasterizerState)) == 0)
+    {
+        this->stats.skippedBinds++;
+        return;
+    }
+
+    this->FlushBatch();
+    this->state.rasterizer = rasterizer;
+
+    if (this->framebuffers.inFrame)
+        this->cmdBuf.bindRasterizerState(this->state.rasterizer);
+    else
+        this->bound.pipelineDirty = true;
 }
 
 /* Encapsulation and Abstraction - fincs */
@@ -525,14 +1145,28 @@ void deko3d::UseProgram(const love::Shader::Program& program)
 {
     this->EnsureInFrame();
 
+    if (this->bound.program == &program)
+    {
+        this->stats.skippedBinds++;
+        return;
+    }
+
+    this->FlushBatch();
+
     this->cmdBuf.bindShaders(DkStageFlag_GraphicsMask, { *program.vertex, *program.fragment });
+    this->stats.shaderSwitches++;
     this->cmdBuf.bindUniformBuffer(DkStage_Vertex, 0, this->transformUniformBuffer.getGpuAddr(),
                                    this->transformUniformBuffer.getSize());
+
+    this->bound.program = &program;
 }
 
 void deko3d::SetDepthWrites(bool enable)
 {
-    this->state.rasterizer.setDepthClampEnable(enable);
+    dk::RasterizerState rasterizer = this->state.rasterizer;
+    rasterizer.setDepthClampEnable(enable);
+
+    this->SetRasterizerState(rasterizer);
 }
 
 // Set the global filter mode for textures
@@ -543,7 +1177,8 @@ void deko3d::SetTextureFilter(const love::Texture::Filter& filter)
     DkFilter mag =
         (filter.min == love::Texture::FILTER_NEAREST) ? DkFilter_Nearest : DkFilter_Linear;
 
-    DkMipFilter mipFilter = DkMipFilter_Linear;
+    /* images without a mip chain keep sampling their only level */
+    DkMipFilter mipFilter = DkMipFilter_None;
     if (filter.mipmap != love::Texture::FILTER_NONE)
     {
         if (filter.min == love::Texture::FILTER_NEAREST &&
@@ -573,6 +1208,7 @@ void deko3d::SetTextureFilter(const love::Texture::Filter& filter)
 void deko3d::SetTextureFilter(love::Texture* texture, const love::Texture::Filter& filter)
 {
     this->EnsureInFrame();
+    this->FlushBatch();
 
     this->SetTextureFilter(filter);
 
@@ -595,6 +1231,7 @@ void deko3d::SetTextureWrap(const love::Texture::Wrap& wrap)
 void deko3d::SetTextureWrap(love::Texture* texture, const love::Texture::Wrap& wrap)
 {
     this->EnsureInFrame();
+    this->FlushBatch();
 
     this->SetTextureWrap(wrap);
 
@@ -666,6 +1303,16 @@ void deko3d::SetScissor(const love::Rect& scissor, bool canvasActive)
     this->EnsureInFrame();
 
     this->scissor = scissor;
+
+    if (this->bound.scissor == scissor)
+    {
+        this->stats.skippedBinds++;
+        return;
+    }
+
+    this->FlushBatch();
+
+    this->bound.scissor = scissor;
     this->cmdBuf.setScissors(0, { { (uint32_t)scissor.x, (uint32_t)scissor.y, (uint32_t)scissor.w,
                                     (uint32_t)scissor.h } });
 }
@@ -679,8 +1326,17 @@ void deko3d::SetViewport(const love::Rect& view)
     this->EnsureInFrame();
 
     this->viewport = view;
-    this->cmdBuf.setViewports(
-        0, { { (float)view.x, (float)view.y, (float)view.w, (float)view.h, Z_NEAR, Z_FAR } });
+
+    if (this->bound.viewport == view)
+        this->stats.skippedBinds++;
+    else
+    {
+        this->FlushBatch();
+
+        this->bound.viewport = view;
+        this->cmdBuf.setViewports(
+            0, { { (float)view.x, (float)view.y, (float)view.w, (float)view.h, Z_NEAR, Z_FAR } });
+    }
 
     this->transformState.projMtx =
         glm::ortho(0.0f, (float)view.w, (float)view.h, 0.0f, Z_NEAR, Z_FAR);
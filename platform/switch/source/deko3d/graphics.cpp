@@ -1,6 +1,7 @@
 #include "deko3d/graphics.h"
 
 #include "common/bidirectionalmap.h"
+#include "modules/math/mathmodule.h"
 #include "polyline/common.h"
 
 using namespace love;
@@ -95,6 +96,14 @@ Graphics::RendererInfo love::deko3d::Graphics::GetRendererInfo() const
     return info;
 }
 
+Graphics::Stats love::deko3d::Graphics::GetStats() const
+{
+    Stats stats = love::Graphics::GetStats();
+    ::deko3d::Instance().GetStats(stats);
+
+    return stats;
+}
+
 void love::deko3d::Graphics::SetColor(Colorf color)
 {
     love::Graphics::SetColor(color);
@@ -150,7 +159,7 @@ void love::deko3d::Graphics::SetDefaultFilter(const Texture::Filter& filter)
 void love::deko3d::Graphics::SetBlendMode(BlendMode mode, BlendAlpha alphamode)
 {
     if (mode != this->states.back().blendMode || alphamode != this->states.back().blendAlphaMode)
-    {} // flush stream draws
+        ::deko3d::Instance().FlushBatch();
 
     if (alphamode != BLENDALPHA_PREMULTIPLIED)
     {
@@ -251,21 +260,21 @@ void love::deko3d::Graphics::Polyline(const Vector2* points, size_t count)
 
     if (lineJoin == LINE_JOIN_NONE)
     {
-        NoneJoinPolyline line;
+        NoneJoinPolyline line(this->polylineArena);
         line.Render(points, count, halfWidth, pixelSize, drawOverdraw);
 
         line.Draw(this);
     }
     else if (lineJoin == LINE_JOIN_BEVEL)
     {
-        BevelJoinPolyline line;
+        BevelJoinPolyline line(this->polylineArena);
         line.Render(points, count, halfWidth, pixelSize, drawOverdraw);
 
         line.Draw(this);
     }
     else if (lineJoin == LINE_JOIN_MITER)
     {
-        MiterJoinPolyline line;
+        MiterJoinPolyline line(this->polylineArena);
         line.Render(points, count, halfWidth, pixelSize, drawOverdraw);
 
         line.Draw(this);
@@ -279,26 +288,104 @@ void love::deko3d::Graphics::Polygon(DrawMode mode, const Vector2* points, size_
         this->Polyline(points, count);
     else
     {
-        Colorf color[1] = { this->GetColor() };
+        int vertexCount = (int)count - ((skipLastVertex) ? 1 : 0);
 
-        const Matrix4& t = this->GetTransform();
-        bool is2D        = t.IsAffine2DTransform();
+        if (vertexCount < 3)
+            return;
 
-        int vertexCount = (int)count - ((skipLastVertex) ? 1 : 0);
+        std::span<const Vector2> polygon(points, vertexCount);
+        size_t triangleCount = (vertexCount - 2) * 3;
+
+        /* a fan only covers convex shapes, anything else gets triangulated */
+        const std::vector<uint32_t>* indices = nullptr;
 
-        Vector2 transformed[vertexCount];
-        std::fill_n(transformed, vertexCount, Vector2 {});
+        if (!Math::IsConvex(polygon))
+            indices = this->GetTriangulation(polygon);
 
-        if (is2D)
-            t.TransformXY(transformed, points, vertexCount);
+        vertex::Vertex* vertices = ::deko3d::Instance().ReserveVertices(
+            DkPrimitive_Triangles, triangleCount, this->GetTransform());
 
-        auto vertices = vertex::GeneratePrimitiveFromVectors(std::span(transformed, vertexCount),
-                                                             std::span(color, 1));
+        if (vertices == nullptr)
+            return;
 
-        ::deko3d::Instance().RenderPolygon(vertices.get(), vertexCount);
+        const vertex::Color8 color = vertex::PackColor(this->GetColor());
+
+        if (indices != nullptr)
+        {
+            for (uint32_t index : *indices)
+                *vertices++ = { { points[index].x, points[index].y }, color, { 0, 0 } };
+        }
+        else
+        {
+            /* fans can't be merged, so unroll it into triangles right in the vertex ring */
+            for (int index = 1; index < vertexCount - 1; index++)
+            {
+                *vertices++ = { { points[0].x, points[0].y }, color, { 0, 0 } };
+                *vertices++ = { { points[index].x, points[index].y }, color, { 0, 0 } };
+                *vertices++ = { { points[index + 1].x, points[index + 1].y }, color, { 0, 0 } };
+            }
+        }
+
+        ::deko3d::Instance().CommitVertices(triangleCount);
     }
 }
 
+/*
+** Triangulating is the slow part of filling a concave polygon,
+** so shapes drawn every frame are looked up by their points.
+** When full, the least recently used one makes room
+** Returns nullptr when @polygon can't be triangulated
+*/
+const std::vector<uint32_t>* love::deko3d::Graphics::GetTriangulation(
+    std::span<const Vector2> polygon)
+{
+    /* FNV-1a over the raw points */
+    uint64_t hash = 0xCBF29CE484222325;
+
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(polygon.data());
+
+    for (size_t i = 0; i < polygon.size_bytes(); i++)
+        hash = (hash ^ bytes[i]) * 0x100000001B3;
+
+    auto found = this->triangulationLookup.find(hash);
+
+    if (found != this->triangulationLookup.end())
+    {
+        auto entry = found->second;
+        this->triangulations.splice(this->triangulations.begin(), this->triangulations, entry);
+
+        if (std::equal(polygon.begin(), polygon.end(), entry->points.begin(),
+                       entry->points.end()))
+            return entry->indices.empty() ? nullptr : &entry->indices;
+
+        /* a different polygon with the same hash takes its place */
+    }
+    else if (this->triangulations.size() >= MAX_TRIANGULATIONS)
+    {
+        auto oldest = std::prev(this->triangulations.end());
+        this->triangulationLookup.erase(oldest->hash);
+
+        this->triangulations.splice(this->triangulations.begin(), this->triangulations, oldest);
+        this->triangulationLookup[hash] = this->triangulations.begin();
+    }
+    else
+    {
+        this->triangulations.emplace_front();
+        this->triangulationLookup[hash] = this->triangulations.begin();
+    }
+
+    Triangulation& triangulation = this->triangulations.front();
+
+    triangulation.hash = hash;
+    triangulation.points.assign(polygon.begin(), polygon.end());
+
+    /* self-intersecting input falls back to the fan */
+    if (!Math::Triangulate(polygon, triangulation.indices))
+        triangulation.indices.clear();
+
+    return triangulation.indices.empty() ? nullptr : &triangulation.indices;
+}
+
 void love::deko3d::Graphics::SetLineWidth(float width)
 {
     ::Graphics::SetLineWidth(width);
@@ -312,6 +399,28 @@ void love::deko3d::Graphics::Line(const Vector2* points, int count)
 
 void love::deko3d::Graphics::Rectangle(DrawMode mode, float x, float y, float width, float height)
 {
+    if (mode == DRAW_FILL)
+    {
+        vertex::Vertex* vertices = ::deko3d::Instance().ReserveVertices(DkPrimitive_Triangles, 6,
+                                                                        this->GetTransform());
+
+        if (vertices == nullptr)
+            return;
+
+        const vertex::Color8 color = vertex::PackColor(this->GetColor());
+
+        vertices[0] = { { x, y }, color, { 0, 0 } };
+        vertices[1] = { { x, y + height }, color, { 0, 0 } };
+        vertices[2] = { { x + width, y + height }, color, { 0, 0 } };
+        vertices[3] = { { x, y }, color, { 0, 0 } };
+        vertices[4] = { { x + width, y + height }, color, { 0, 0 } };
+        vertices[5] = { { x + width, y }, color, { 0, 0 } };
+
+        ::deko3d::Instance().CommitVertices(6);
+
+        return;
+    }
+
     Vector2 coords[5] = { Vector2(x, y), Vector2(x, y + height), Vector2(x + width, y + height),
                           Vector2(x + width, y), Vector2(x, y) };
 
@@ -399,18 +508,43 @@ void love::deko3d::Graphics::Ellipse(DrawMode mode, float x, float y, float a, f
     float angle_shift = (two_pi / points);
     float phi         = .0f;
 
-    // 1 extra point at the end for a closed loop, and 1 extra point at the
-    // start in filled mode for the vertex in the center of the ellipse.
-    int extrapoints = 1 + (mode == DRAW_FILL ? 1 : 0);
-
-    Vector2 coords[points + extrapoints] = {};
-
     if (mode == DRAW_FILL)
     {
-        coords[0].x = x;
-        coords[0].y = y;
+        /* one triangle from the center for every edge, written into the vertex ring */
+        size_t triangleCount = points * 3;
+
+        vertex::Vertex* vertices = ::deko3d::Instance().ReserveVertices(
+            DkPrimitive_Triangles, triangleCount, this->GetTransform());
+
+        if (vertices == nullptr)
+            return;
+
+        const vertex::Color8 color = vertex::PackColor(this->GetColor());
+
+        Vector2 first(x + a, y);
+        Vector2 previous = first;
+
+        for (int i = 1; i <= points; ++i)
+        {
+            phi += angle_shift;
+
+            Vector2 next = (i == points) ? first : Vector2(x + a * cosf(phi), y + b * sinf(phi));
+
+            *vertices++ = { { x, y }, color, { 0, 0 } };
+            *vertices++ = { { previous.x, previous.y }, color, { 0, 0 } };
+            *vertices++ = { { next.x, next.y }, color, { 0, 0 } };
+
+            previous = next;
+        }
+
+        ::deko3d::Instance().CommitVertices(triangleCount);
+
+        return;
     }
 
+    // 1 extra point at the end for a closed loop.
+    Vector2 coords[points + 1] = {};
+
     for (int i = 0; i < points; ++i, phi += angle_shift)
     {
         coords[i].x = x + a * cosf(phi);
@@ -419,8 +553,7 @@ void love::deko3d::Graphics::Ellipse(DrawMode mode, float x, float y, float a, f
 
     coords[points] = coords[0];
 
-    // Last argument to polygon(): don't skip the last vertex in fill mode.
-    this->Polygon(mode, coords, points + extrapoints, false);
+    this->Polygon(mode, coords, points + 1, false);
 }
 
 void love::deko3d::Graphics::Circle(DrawMode mode, float x, float y, float radius)
@@ -478,8 +611,8 @@ void love::deko3d::Graphics::Arc(DrawMode drawmode, ArcMode arcmode, float x, fl
 
     float phi = angle1;
 
-    int num_coords  = 0;
-    Vector2* coords = nullptr;
+    int num_coords = 0;
+    Vector2 coords[points + 3];
 
     const auto createPoints = [&](Vector2* coordinates) {
         for (int i = 0; i <= points; ++i, phi += angle_shift)
@@ -492,7 +625,6 @@ void love::deko3d::Graphics::Arc(DrawMode drawmode, ArcMode arcmode, float x, fl
     if (arcmode == ARC_PIE)
     {
         num_coords = points + 3;
-        coords     = new Vector2[num_coords];
 
         coords[0] = coords[num_coords - 1] = Vector2(x, y);
 
@@ -501,14 +633,12 @@ void love::deko3d::Graphics::Arc(DrawMode drawmode, ArcMode arcmode, float x, fl
     else if (arcmode == ARC_OPEN)
     {
         num_coords = points + 1;
-        coords     = new Vector2[num_coords];
 
         createPoints(coords);
     }
     else // ARC_CLOSED
     {
         num_coords = points + 2;
-        coords     = new Vector2[num_coords];
 
         createPoints(coords);
 
@@ -517,28 +647,31 @@ void love::deko3d::Graphics::Arc(DrawMode drawmode, ArcMode arcmode, float x, fl
     }
 
     this->Polygon(drawmode, coords, num_coords);
-    delete[] coords;
 }
 
 void love::deko3d::Graphics::Points(const Vector2* points, size_t count, const Colorf* colors,
                                     size_t colorCount)
 {
-    const Matrix4& t = this->GetTransform();
-    bool is2D        = t.IsAffine2DTransform();
+    if (count == 0 || colorCount == 0)
+        return;
 
-    Vector2 transformed[count];
-    std::fill_n(transformed, count, Vector2 {});
+    vertex::Vertex* vertices =
+        ::deko3d::Instance().ReserveVertices(DkPrimitive_Points, count, this->GetTransform());
 
-    if (is2D)
-        t.TransformXY(transformed, points, count);
+    if (vertices == nullptr)
+        return;
+
+    vertex::Color8 color = vertex::PackColor(colors[0]);
 
-    Colorf colorList[colorCount];
-    memcpy(colorList, colors, colorCount);
+    for (size_t index = 0; index < count; index++)
+    {
+        if (index < colorCount)
+            color = vertex::PackColor(colors[index]);
 
-    auto vertices = vertex::GeneratePrimitiveFromVectors(std::span(transformed, count),
-                                                         std::span(colorList, colorCount));
+        vertices[index] = { { points[index].x, points[index].y }, color, { 0, 0 } };
+    }
 
-    ::deko3d::Instance().RenderPoints(vertices.get(), count);
+    ::deko3d::Instance().CommitVertices(count);
 }
 
 void love::deko3d::Graphics::SetPointSize(float size)
@@ -17,6 +17,9 @@ Shader* love::Shader::standardShaders[love::Shader::STANDARD_MAX_ENUM] = { nullp
 #define DEFAULT_TEXTURE_SHADER  (SHADERS_DIR "texture_fsh.dksh")
 #define DEFAULT_VIDEO_SHADER    (SHADERS_DIR "video_fsh.dksh")
 
+#define INSTANCE_VERTEX_SHADER      (SHADERS_DIR "instance_vsh.dksh")
+#define QUAD_INSTANCE_VERTEX_SHADER (SHADERS_DIR "quad_instance_vsh.dksh")
+
 Shader::Shader() : program()
 {}
 
@@ -60,6 +63,20 @@ void Shader::LoadDefaults(StandardShader type)
         case STANDARD_VIDEO:
             this->program.vertex->load(::deko3d::Instance().GetCode(), DEFAULT_VERTEX_SHADER);
             this->program.fragment->load(::deko3d::Instance().GetCode(), DEFAULT_VIDEO_SHADER);
+            break;
+        case STANDARD_INSTANCED:
+            this->program.vertex->load(::deko3d::Instance().GetCode(), INSTANCE_VERTEX_SHADER);
+            this->program.fragment->load(::deko3d::Instance().GetCode(), DEFAULT_FRAGMENT_SHADER);
+            break;
+        case STANDARD_INSTANCED_TEXTURE:
+            this->program.vertex->load(::deko3d::Instance().GetCode(), INSTANCE_VERTEX_SHADER);
+            this->program.fragment->load(::deko3d::Instance().GetCode(), DEFAULT_TEXTURE_SHADER);
+            break;
+        case STANDARD_INSTANCED_QUAD:
+            this->program.vertex->load(::deko3d::Instance().GetCode(),
+                                       QUAD_INSTANCE_VERTEX_SHADER);
+            this->program.fragment->load(::deko3d::Instance().GetCode(), DEFAULT_TEXTURE_SHADER);
+            break;
         default:
             break;
     }
@@ -138,9 +155,12 @@ void Shader::Attach()
 
 // clang-format off
 constexpr auto shaderNames = BidirectionalMap<>::Create(
-    "default", Shader::StandardShader::STANDARD_DEFAULT,
-    "texture", Shader::StandardShader::STANDARD_TEXTURE,
-    "video",   Shader::StandardShader::STANDARD_VIDEO
+    "default",          Shader::StandardShader::STANDARD_DEFAULT,
+    "texture",          Shader::StandardShader::STANDARD_TEXTURE,
+    "video",            Shader::StandardShader::STANDARD_VIDEO,
+    "instanced",        Shader::StandardShader::STANDARD_INSTANCED,
+    "instancedtexture", Shader::StandardShader::STANDARD_INSTANCED_TEXTURE,
+    "instancedquad",    Shader::StandardShader::STANDARD_INSTANCED_QUAD
 );
 // clang-format on
 
@@ -8,42 +8,30 @@ std::vector<vertex::Vertex> vertex::GenerateTextureFromVectors(const love::Vecto
                                                                size_t count, Colorf color)
 {
     std::vector<vertex::Vertex> verts(count);
+    const Color8 packed = PackColor(color);
 
     for (size_t currentVertex = 0; currentVertex < count; currentVertex++)
     {
         const Vector2 point    = points[currentVertex];
         const Vector2 texCoord = texcoord[currentVertex];
 
-        vertex::Vertex vert = { .position = { point.x, point.y, 0.0f },
-                                .color    = { 1, 1, 1, 1 },
-                                .texcoord = { normto16t(texCoord.x), normto16t(texCoord.y) } };
-
-        color.CopyTo(vert.color);
-
-        verts[currentVertex] = vert;
+        verts[currentVertex] = { .position = { point.x, point.y },
+                                 .color    = packed,
+                                 .texcoord = { normto16t(texCoord.x), normto16t(texCoord.y) } };
     }
 
     return verts;
 }
 
-std::vector<vertex::Vertex> vertex::GenerateTextureFromGlyphs(const vertex::GlyphVertex* data,
-                                                              size_t count)
+void vertex::GenerateTextureFromGlyphs(const vertex::GlyphVertex* data, size_t count,
+                                       vertex::Vertex* out)
 {
-    std::vector<vertex::Vertex> verts(count);
-
     for (size_t currentVertex = 0; currentVertex < count; currentVertex++)
     {
-        const GlyphVertex vertex = data[currentVertex];
-        Colorf color             = vertex.color;
+        const GlyphVertex& vertex = data[currentVertex];
 
-        vertex::Vertex vert = { .position = { vertex.x, vertex.y, 0.0f },
-                                .color    = { 1, 1, 1, 1 },
-                                .texcoord = { vertex.s, vertex.t } };
-
-        color.CopyTo(vert.color);
-
-        verts[currentVertex] = vert;
+        out[currentVertex] = { .position = { vertex.x, vertex.y },
+                               .color    = PackColor(vertex.color),
+                               .texcoord = { vertex.s, vertex.t } };
     }
-
-    return verts;
 }
@@ -22,16 +22,19 @@ Canvas::Canvas(const Canvas::Settings& settings) : common::Canvas(settings), des
     this->colorBuffer.initialize(layoutColorBuffer, this->colorMemory.getMemBlock(),
                                  this->colorMemory.getOffset());
 
-    // Clear to transparent black
-    ::deko3d::Instance().BindFramebuffer(this);
-    ::deko3d::Instance().ClearColor({ 0, 0, 0, 0 });
-    ::deko3d::Instance().BindFramebuffer();
+    this->SetGraphicsMemorySize(this->colorMemory.getSize());
 
     dk::ImageView view { this->colorBuffer };
     this->descriptor.initialize(view);
 
     // Register the texture handle for the descriptor
+    // The clear below records it as written, so it needs the handle first
     this->handle = ::deko3d::Instance().RegisterResHandle(this->descriptor);
+
+    // Clear to transparent black
+    ::deko3d::Instance().BindFramebuffer(this);
+    ::deko3d::Instance().ClearColor({ 0, 0, 0, 0 });
+    ::deko3d::Instance().BindFramebuffer();
 }
 
 Canvas::~Canvas()
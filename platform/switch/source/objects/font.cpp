@@ -22,7 +22,8 @@ Font::Font(Rasterizer* r, const Texture::Filter& filter) :
     textureWidth(128),
     textureHeight(128),
     useSpacesAsTab(false),
-    textureCacheID(0)
+    textureCacheID(0),
+    dirtyRect {}
 {
     this->dpiScale = rasterizers[0]->GetDPIScale();
     this->height   = rasterizers[0]->GetHeight();
@@ -113,21 +114,27 @@ void Font::CreateTexture()
         recreatetexture = true;
         size            = nextSize;
         images.pop_back();
-    }
-
-    texture =
-        gfx->NewImage(love::Texture::TEXTURE_2D, PIXELFORMAT_RGBA8, size.width, size.height, 1);
-    texture->SetFilter(this->filter);
 
+        /* Its glyphs are re-added to the new atlas below */
+        this->dirtyRect = {};
+    }
+    else
     {
-        size_t bytesPerPixel = love::GetPixelFormatSize(PIXELFORMAT_RGBA8);
-        size_t pixelCount    = size.width * size.height;
+        /* Anything still queued for the current atlas has to land first */
+        this->UploadGlyphs();
+    }
 
-        std::vector<uint8_t> empty(pixelCount * bytesPerPixel, 0);
-        Rect rect = { 0, 0, size.width, size.height };
+    /*
+    ** Glyphs only need coverage, so the atlas is R8 and
+    ** sampled as white with the red channel as alpha
+    ** New images start out as transparent black already
+    */
+    texture = gfx->NewImage(love::Texture::TEXTURE_2D, PIXELFORMAT_R8, size.width, size.height, 1);
+    texture->SetSwizzle(DkImageSwizzle_One, DkImageSwizzle_One, DkImageSwizzle_One,
+                        DkImageSwizzle_Red);
+    texture->SetFilter(this->filter);
 
-        texture->ReplacePixels(empty.data(), empty.size(), rect);
-    }
+    this->atlasPixels.assign(size.width * size.height, 0);
 
     this->images.emplace_back(texture, Acquire::NORETAIN);
 
@@ -152,6 +159,30 @@ void Font::CreateTexture()
     }
 }
 
+void Font::UploadGlyphs()
+{
+    if (this->dirtyRect.w == 0 || this->images.empty())
+        return;
+
+    const Rect& rect    = this->dirtyRect;
+    const uint8_t* rows = &this->atlasPixels[rect.y * this->textureWidth];
+
+    /* Full rows are already contiguous, anything else gets packed */
+    if (rect.x == 0 && rect.w == this->textureWidth)
+        this->images.back()->ReplacePixels(rows, rect.w * rect.h, rect);
+    else
+    {
+        std::vector<uint8_t> region(rect.w * rect.h);
+
+        for (int y = 0; y < rect.h; y++)
+            memcpy(&region[y * rect.w], &rows[y * this->textureWidth + rect.x], rect.w);
+
+        this->images.back()->ReplacePixels(region.data(), region.size(), rect);
+    }
+
+    this->dirtyRect = {};
+}
+
 uint32_t Font::GetTextureCacheID()
 {
     return this->textureCacheID;
@@ -257,9 +288,32 @@ const Font::Glyph& Font::AddGlyph(uint32_t glyph)
         Image* image = images.back();
         g.texture    = image;
 
-        Rect rect = { this->textureX, this->textureY, gd->GetWidth(), gd->GetHeight() };
+        /* GlyphData is white RGBA8, keep only its alpha for the R8 atlas */
+        const uint8_t* source = (const uint8_t*)gd->GetData();
+        size_t pixelSize      = gd->GetPixelSize();
+
+        for (int y = 0; y < height; y++)
+        {
+            uint8_t* row = &this->atlasPixels[(this->textureY + y) * this->textureWidth];
 
-        image->ReplacePixels(gd->GetData(), gd->GetSize(), rect);
+            for (int x = 0; x < width; x++)
+                row[this->textureX + x] = source[(y * width + x) * pixelSize + 3];
+        }
+
+        Rect rect = { this->textureX, this->textureY, width, height };
+
+        if (this->dirtyRect.w == 0)
+            this->dirtyRect = rect;
+        else
+        {
+            int right  = std::max(this->dirtyRect.x + this->dirtyRect.w, rect.x + rect.w);
+            int bottom = std::max(this->dirtyRect.y + this->dirtyRect.h, rect.y + rect.h);
+
+            this->dirtyRect.x = std::min(this->dirtyRect.x, rect.x);
+            this->dirtyRect.y = std::min(this->dirtyRect.y, rect.y);
+            this->dirtyRect.w = right - this->dirtyRect.x;
+            this->dirtyRect.h = bottom - this->dirtyRect.y;
+        }
 
         double tX = (double)this->textureX, tY = (double)this->textureY;
         double tWidth = (double)this->textureWidth, tHeight = (double)this->textureHeight;
@@ -668,18 +722,20 @@ void Font::PrintV(Graphics* gfx, const Matrix4& t, const std::vector<DrawCommand
     if (vertices.empty() || drawCommands.empty())
         return;
 
-    Matrix4 m(gfx->GetTransform(), t);
+    this->UploadGlyphs();
 
     for (const DrawCommand& cmd : drawCommands)
     {
         vertex::GlyphVertex vertexData[cmd.vertexCount];
 
         memcpy(vertexData, &vertices[cmd.startVertex], sizeof(GlyphVertex) * cmd.vertexCount);
-        m.TransformXY(vertexData, &vertices[cmd.startVertex], cmd.vertexCount);
+        Matrix4 m = ::deko3d::SplitTransform(gfx->GetTransform(), t, vertexData,
+                                             &vertices[cmd.startVertex], cmd.vertexCount);
 
-        std::vector<Vertex> verts = vertex::GenerateTextureFromGlyphs(vertexData, cmd.vertexCount);
+        vertex::Vertex verts[cmd.vertexCount];
+        vertex::GenerateTextureFromGlyphs(vertexData, cmd.vertexCount, verts);
 
-        ::deko3d::Instance().RenderTexture(cmd.texture->GetHandle(), verts.data(), cmd.vertexCount);
+        ::deko3d::Instance().RenderTexture(cmd.texture->GetHandle(), verts, cmd.vertexCount, m);
     }
 }
 
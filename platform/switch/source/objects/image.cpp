@@ -15,6 +15,8 @@ Image::Image(const Slices& slices, bool validate) :
 {
     if (validate && data.Validate() == MIPMAPS_DATA)
         this->mipmapsType = MIPMAPS_DATA;
+
+    imageCount++;
 }
 
 Image::Image(TextureType type, PixelFormat format, int width, int height, int slices) :
@@ -26,13 +28,25 @@ Image::Image(TextureType type, PixelFormat format, int width, int height, int sl
     this->Init(format, width, height);
 }
 
-Image::Image(const Slices& slices) : Image(slices, true)
+Image::Image(const Slices& slices, const Settings& settings) : Image(slices, true)
 {
-    this->Init(slices.Get(0, 0));
+    ImageDataBase* base = slices.Get(0, 0);
+
+    /* compressed data can only bring its own levels */
+    if (settings.mipmaps && this->mipmapsType == MIPMAPS_NONE &&
+        !love::IsPixelFormatCompressed(base->GetFormat()))
+        this->mipmapsType = MIPMAPS_GENERATED;
+
+    if (this->mipmapsType != MIPMAPS_NONE)
+        this->filter.mipmap = Texture::defaultMipmapFilter;
+
+    this->Init(base);
 }
 
 Image::~Image()
-{}
+{
+    --imageCount;
+}
 
 void Image::Init(ImageDataBase* data)
 {
@@ -43,10 +57,30 @@ void Image::Init(PixelFormat pixelFormat, int width, int height)
 {
     PixelFormat format = pixelFormat;
 
+    if (this->mipmapsType == MIPMAPS_DATA)
+        this->mipmapCount = this->data.GetMipmapCount();
+    else if (this->mipmapsType == MIPMAPS_GENERATED)
+        this->mipmapCount = Texture::GetTotalMipmapCount(width, height);
+
     if (this->data.Get(0, 0))
     {
+        bool generated = (this->mipmapsType == MIPMAPS_GENERATED);
+
         bool success = this->texture.load(format, this->sRGB, this->data.Get(0, 0)->GetData(),
-                                          this->data.Get(0, 0)->GetSize(), width, height);
+                                          this->data.Get(0, 0)->GetSize(), width, height, false,
+                                          this->mipmapCount, generated);
+
+        if (success && this->mipmapsType == MIPMAPS_GENERATED)
+            success = this->texture.generateMipmaps();
+        else if (this->mipmapsType == MIPMAPS_DATA)
+        {
+            /* levels that came with the data upload as-is */
+            for (int level = 1; success && level < this->mipmapCount; level++)
+            {
+                ImageDataBase* mipmap = this->data.Get(0, level);
+                success = this->texture.replaceMipmap(mipmap->GetData(), mipmap->GetSize(), level);
+            }
+        }
 
         if (!success)
         {
@@ -65,6 +99,8 @@ void Image::Init(PixelFormat pixelFormat, int width, int height)
     this->width  = width;
     this->height = height;
 
+    this->SetGraphicsMemorySize(this->texture.getSize());
+
     this->handle = ::deko3d::Instance().RegisterResHandle(this->texture.getDescriptor());
 
     this->InitQuad();
@@ -75,6 +111,17 @@ void Image::Init(PixelFormat pixelFormat, int width, int height)
 
 void Image::ReplacePixels(const void* data, size_t size, const Rect& rect)
 {
-    this->texture.replacePixels(::deko3d::Instance().GetData(), ::deko3d::Instance().GetDevice(),
-                                data, size, ::deko3d::Instance().GetTextureQueue(), rect);
+    this->texture.replacePixels(data, size, rect);
+
+    if (this->mipmapsType == MIPMAPS_GENERATED)
+        this->texture.generateMipmaps();
+}
+
+void Image::GenerateMipmaps()
+{
+    if (this->mipmapsType != MIPMAPS_GENERATED)
+        throw love::Exception("generateMipmaps can only be called on an Image which was created "
+                              "with the 'mipmaps' setting.");
+
+    this->texture.generateMipmaps();
 }
@@ -0,0 +1,124 @@
+#include "objects/instancebuffer/instancebuffer.h"
+
+#include "common/exception.h"
+
+#include "deko3d/deko.h"
+
+using namespace love;
+
+love::Type InstanceBuffer::type("InstanceBuffer", &Object::type);
+
+InstanceBuffer::InstanceBuffer(size_t size, vertex::Usage usage) :
+    buffer(size * sizeof(vertex::Instance), alignof(vertex::Instance), usage),
+    dirtyStart(0),
+    dirtyEnd(size)
+{
+    if (size == 0)
+        throw love::Exception("An InstanceBuffer must have at least one instance.");
+
+    vertex::Instance empty = { .offset   = { 0.0f, 0.0f },
+                               .scale    = { 1.0f, 1.0f },
+                               .rotation = 0.0f,
+                               .color    = { 0xFF, 0xFF, 0xFF, 0xFF },
+                               .texRect  = { 0, 0, 0xFFFF, 0xFFFF } };
+
+    this->instances.resize(size, empty);
+}
+
+InstanceBuffer::~InstanceBuffer()
+{}
+
+void InstanceBuffer::CheckIndex(size_t index) const
+{
+    if (index >= this->instances.size())
+        throw love::Exception("Invalid instance index: %zu", index + 1);
+}
+
+void InstanceBuffer::MarkDirty(size_t index)
+{
+    if (this->dirtyStart >= this->dirtyEnd)
+    {
+        this->dirtyStart = index;
+        this->dirtyEnd   = index + 1;
+
+        return;
+    }
+
+    this->dirtyStart = std::min(this->dirtyStart, index);
+    this->dirtyEnd   = std::max(this->dirtyEnd, index + 1);
+}
+
+void InstanceBuffer::SetInstance(size_t index, float x, float y, float angle, float sx, float sy)
+{
+    this->CheckIndex(index);
+
+    vertex::Instance& instance = this->instances[index];
+
+    instance.offset[0] = x;
+    instance.offset[1] = y;
+    instance.scale[0]  = sx;
+    instance.scale[1]  = sy;
+    instance.rotation  = angle;
+
+    this->MarkDirty(index);
+}
+
+void InstanceBuffer::SetColor(size_t index, const Colorf& color)
+{
+    this->CheckIndex(index);
+
+    this->instances[index].color = vertex::PackColor(color);
+    this->MarkDirty(index);
+}
+
+void InstanceBuffer::SetQuad(size_t index, Quad* quad)
+{
+    this->CheckIndex(index);
+
+    const Quad::Viewport& viewport = quad->GetViewport();
+
+    double sw = quad->GetTextureWidth();
+    double sh = quad->GetTextureHeight();
+
+    uint16_t* texRect = this->instances[index].texRect;
+
+    texRect[0] = vertex::normto16t(viewport.x / sw);
+    texRect[1] = vertex::normto16t(viewport.y / sh);
+    texRect[2] = vertex::normto16t(viewport.w / sw);
+    texRect[3] = vertex::normto16t(viewport.h / sh);
+
+    this->MarkDirty(index);
+}
+
+const vertex::Instance& InstanceBuffer::GetInstance(size_t index) const
+{
+    this->CheckIndex(index);
+
+    return this->instances[index];
+}
+
+size_t InstanceBuffer::GetCount() const
+{
+    return this->instances.size();
+}
+
+void InstanceBuffer::Flush()
+{
+    if (this->dirtyStart >= this->dirtyEnd)
+        return;
+
+    const uint32_t stride = sizeof(vertex::Instance);
+
+    if (!this->buffer.update(this->instances.data(), this->instances.size() * stride,
+                             this->dirtyStart * stride, this->dirtyEnd * stride))
+    {
+        throw love::Exception("Out of memory allocating InstanceBuffer.");
+    }
+
+    this->dirtyStart = this->dirtyEnd = 0;
+}
+
+const CMemPool::Handle& InstanceBuffer::UseBuffer()
+{
+    return this->buffer.use();
+}
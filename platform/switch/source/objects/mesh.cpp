@@ -0,0 +1,313 @@
+#include "objects/mesh/mesh.h"
+
+#include "common/bidirectionalmap.h"
+#include "common/exception.h"
+
+#include "deko3d/deko.h"
+#include "modules/graphics/graphics.h"
+
+using namespace love;
+
+love::Type Mesh::type("Mesh", &Drawable::type);
+
+Mesh::Mesh(const std::vector<AttributeFormat>& format, const std::vector<vertex::Vertex>& vertices,
+           DrawMode mode, vertex::Usage usage) :
+    format(format),
+    vertices(vertices),
+    buffer(vertices.size() * sizeof(vertex::Vertex), alignof(vertex::Vertex), usage),
+    dirtyStart(0),
+    dirtyEnd(vertices.size()),
+    indexBuffer(0, alignof(uint32_t), usage),
+    useVertexMap(false),
+    mode(mode),
+    usage(usage),
+    rangeStart(-1),
+    rangeCount(-1)
+{
+    if (vertices.empty())
+        throw love::Exception("A Mesh must have at least one vertex.");
+}
+
+Mesh::~Mesh()
+{}
+
+void Mesh::MarkDirty(size_t start, size_t end)
+{
+    if (this->dirtyStart >= this->dirtyEnd)
+    {
+        this->dirtyStart = start;
+        this->dirtyEnd   = end;
+
+        return;
+    }
+
+    this->dirtyStart = std::min(this->dirtyStart, start);
+    this->dirtyEnd   = std::max(this->dirtyEnd, end);
+}
+
+void Mesh::SetVertex(size_t index, const vertex::Vertex& vertex)
+{
+    if (index >= this->vertices.size())
+        throw love::Exception("Invalid vertex index: %zu", index + 1);
+
+    this->vertices[index] = vertex;
+    this->MarkDirty(index, index + 1);
+}
+
+const vertex::Vertex& Mesh::GetVertex(size_t index) const
+{
+    if (index >= this->vertices.size())
+        throw love::Exception("Invalid vertex index: %zu", index + 1);
+
+    return this->vertices[index];
+}
+
+void Mesh::SetVertices(size_t start, const std::vector<vertex::Vertex>& vertices)
+{
+    if (start + vertices.size() > this->vertices.size())
+        throw love::Exception("Too many vertices (expected at most %zu, got %zu)",
+                              this->vertices.size() - start, vertices.size());
+
+    std::copy(vertices.begin(), vertices.end(), this->vertices.begin() + start);
+    this->MarkDirty(start, start + vertices.size());
+}
+
+size_t Mesh::GetVertexCount() const
+{
+    return this->vertices.size();
+}
+
+const std::vector<Mesh::AttributeFormat>& Mesh::GetVertexFormat() const
+{
+    return this->format;
+}
+
+void Mesh::SetVertexMap(const std::vector<uint32_t>& map)
+{
+    for (uint32_t index : map)
+    {
+        if (index >= this->vertices.size())
+            throw love::Exception("Invalid vertex map value: %u", index + 1);
+    }
+
+    uint32_t size = map.size() * sizeof(uint32_t);
+
+    if (size > this->indexBuffer.getCapacity())
+        this->indexBuffer.resize(size);
+
+    if (!this->indexBuffer.update(map.data(), size, 0, size))
+        throw love::Exception("Out of memory allocating Mesh index buffer.");
+
+    this->vertexMap    = map;
+    this->useVertexMap = true;
+}
+
+void Mesh::SetVertexMap()
+{
+    this->useVertexMap = false;
+}
+
+bool Mesh::GetVertexMap(std::vector<uint32_t>& map) const
+{
+    if (!this->useVertexMap)
+        return false;
+
+    map = this->vertexMap;
+
+    return true;
+}
+
+void Mesh::SetTexture(Texture* texture)
+{
+    this->texture.Set(texture);
+}
+
+void Mesh::SetTexture()
+{
+    this->texture.Set(nullptr);
+}
+
+Texture* Mesh::GetTexture() const
+{
+    return this->texture.Get();
+}
+
+void Mesh::SetDrawMode(DrawMode mode)
+{
+    this->mode = mode;
+}
+
+Mesh::DrawMode Mesh::GetDrawMode() const
+{
+    return this->mode;
+}
+
+void Mesh::SetDrawRange(int start, int count)
+{
+    if (start < 0 || count <= 0)
+        throw love::Exception("Invalid draw range.");
+
+    this->rangeStart = start;
+    this->rangeCount = count;
+}
+
+void Mesh::SetDrawRange()
+{
+    this->rangeStart = this->rangeCount = -1;
+}
+
+bool Mesh::GetDrawRange(int& start, int& count) const
+{
+    if (this->rangeStart < 0 || this->rangeCount <= 0)
+        return false;
+
+    start = this->rangeStart;
+    count = this->rangeCount;
+
+    return true;
+}
+
+void Mesh::Flush()
+{
+    if (this->dirtyStart >= this->dirtyEnd)
+        return;
+
+    const uint32_t stride = sizeof(vertex::Vertex);
+
+    if (!this->buffer.update(this->vertices.data(), this->vertices.size() * stride,
+                             this->dirtyStart * stride, this->dirtyEnd * stride))
+    {
+        throw love::Exception("Out of memory allocating Mesh vertex buffer.");
+    }
+
+    this->dirtyStart = this->dirtyEnd = 0;
+}
+
+static DkPrimitive GetDekoPrimitive(Mesh::DrawMode mode)
+{
+    switch (mode)
+    {
+        case Mesh::DRAWMODE_FAN:
+        default:
+            return DkPrimitive_TriangleFan;
+        case Mesh::DRAWMODE_STRIP:
+            return DkPrimitive_TriangleStrip;
+        case Mesh::DRAWMODE_TRIANGLES:
+            return DkPrimitive_Triangles;
+        case Mesh::DRAWMODE_POINTS:
+            return DkPrimitive_Points;
+    }
+}
+
+void Mesh::Draw(Graphics* gfx, const Matrix4& localTransform)
+{
+    this->Render(gfx, localTransform, nullptr, 0);
+}
+
+void Mesh::DrawInstanced(Graphics* gfx, InstanceBuffer* instances, int count,
+                         const Matrix4& localTransform)
+{
+    count = std::min(count, (int)instances->GetCount());
+
+    if (count <= 0)
+        return;
+
+    this->Render(gfx, localTransform, instances, count);
+}
+
+void Mesh::Render(Graphics* gfx, const Matrix4& localTransform, InstanceBuffer* instances,
+                  int instanceCount)
+{
+    int total = this->useVertexMap ? this->vertexMap.size() : this->vertices.size();
+
+    int start = 0;
+    int count = total;
+
+    if (this->rangeStart >= 0 && this->rangeCount > 0)
+    {
+        start = std::min(this->rangeStart, total);
+        count = std::min(this->rangeCount, total - start);
+    }
+
+    if (count <= 0)
+        return;
+
+    this->Flush();
+
+    Matrix4 transform(gfx->GetTransform(), localTransform);
+
+    DkResHandle handle         = 0;
+    const DkResHandle* texture = nullptr;
+
+    if (this->texture.Get() != nullptr)
+    {
+        handle  = this->texture->GetHandle();
+        texture = &handle;
+    }
+
+    DkPrimitive mode = GetDekoPrimitive(this->mode);
+
+    ::deko3d::Instances instanceData {};
+
+    if (instances != nullptr)
+    {
+        instances->Flush();
+
+        instanceData = { &instances->UseBuffer(), 0, (uint32_t)instanceCount };
+    }
+
+    const CMemPool::Handle* indices = this->useVertexMap ? &this->indexBuffer.use() : nullptr;
+
+    ::deko3d::Instance().RenderBuffer(mode, texture, this->buffer.use(), start, count, transform,
+                                      indices, 0, (instances != nullptr) ? &instanceData : nullptr);
+}
+
+std::vector<Mesh::AttributeFormat> Mesh::GetDefaultFormat()
+{
+    return { { ATTRIB_POSITION, 2 }, { ATTRIB_TEXCOORD, 2 }, { ATTRIB_COLOR, 4 } };
+}
+
+// clang-format off
+constexpr auto drawModes = BidirectionalMap<>::Create(
+    "fan",       Mesh::DrawMode::DRAWMODE_FAN,
+    "strip",     Mesh::DrawMode::DRAWMODE_STRIP,
+    "triangles", Mesh::DrawMode::DRAWMODE_TRIANGLES,
+    "points",    Mesh::DrawMode::DRAWMODE_POINTS
+);
+
+constexpr auto attributeTypes = BidirectionalMap<>::Create(
+    "VertexPosition", Mesh::AttributeType::ATTRIB_POSITION,
+    "VertexTexCoord", Mesh::AttributeType::ATTRIB_TEXCOORD,
+    "VertexColor",    Mesh::AttributeType::ATTRIB_COLOR
+);
+// clang-format on
+
+bool Mesh::GetConstant(const char* in, DrawMode& out)
+{
+    return drawModes.Find(in, out);
+}
+
+bool Mesh::GetConstant(DrawMode in, const char*& out)
+{
+    return drawModes.ReverseFind(in, out);
+}
+
+std::vector<const char*> Mesh::GetConstants(DrawMode)
+{
+    return drawModes.GetNames();
+}
+
+bool Mesh::GetConstant(const char* in, AttributeType& out)
+{
+    return attributeTypes.Find(in, out);
+}
+
+bool Mesh::GetConstant(AttributeType in, const char*& out)
+{
+    return attributeTypes.ReverseFind(in, out);
+}
+
+std::vector<const char*> Mesh::GetConstants(AttributeType)
+{
+    return attributeTypes.GetNames();
+}
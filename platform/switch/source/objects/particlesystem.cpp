@@ -0,0 +1,78 @@
+#include "objects/particlesystem/particlesystem.h"
+
+#include "deko3d/deko.h"
+#include "modules/graphics/graphics.h"
+
+using namespace love;
+
+ParticleSystem::ParticleSystem(Texture* texture, uint32_t size) :
+    common::ParticleSystem(texture, size)
+{}
+
+/*
+** Every live particle becomes one quad, and all of them
+** are handed to the renderer at once as a single draw
+*/
+void ParticleSystem::Draw(Graphics* gfx, const Matrix4& localTransform)
+{
+    uint32_t count = this->activeCount;
+
+    if (count == 0)
+        return;
+
+    const size_t vertexCount = count * Texture::TEXTURE_QUAD_POINT_COUNT;
+
+    if (this->vertices.size() < vertexCount)
+    {
+        this->positions.resize(vertexCount);
+        this->vertices.resize(vertexCount);
+    }
+
+    const Quad* quad         = this->texture->GetQuad();
+    const Vector2* corners   = quad->GetVertexPositions();
+    const Vector2* texCoords = quad->GetVertexTexCoords();
+
+    const auto& p = this->particles;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        float c = cosf(p.angle[i]) * p.size[i];
+        float s = sinf(p.angle[i]) * p.size[i];
+
+        Vector2* quadPositions = &this->positions[i * Texture::TEXTURE_QUAD_POINT_COUNT];
+
+        for (size_t j = 0; j < Texture::TEXTURE_QUAD_POINT_COUNT; j++)
+        {
+            float x = corners[j].x - this->offset.x;
+            float y = corners[j].y - this->offset.y;
+
+            quadPositions[j].x = p.x[i] + x * c - y * s;
+            quadPositions[j].y = p.y[i] + x * s + y * c;
+        }
+    }
+
+    Matrix4 transform = ::deko3d::SplitTransform(gfx->GetTransform(), localTransform,
+                                                 this->positions.data(), this->positions.data(),
+                                                 vertexCount);
+
+    const Colorf color = gfx->GetColor();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const vertex::Color8 packed = vertex::PackColor(
+            Colorf(p.r[i] * color.r, p.g[i] * color.g, p.b[i] * color.b, p.a[i] * color.a));
+
+        for (size_t j = 0; j < Texture::TEXTURE_QUAD_POINT_COUNT; j++)
+        {
+            size_t index = i * Texture::TEXTURE_QUAD_POINT_COUNT + j;
+
+            this->vertices[index] = { { this->positions[index].x, this->positions[index].y },
+                                      packed,
+                                      { vertex::normto16t(texCoords[j].x),
+                                        vertex::normto16t(texCoords[j].y) } };
+        }
+    }
+
+    ::deko3d::Instance().RenderTexture(this->texture->GetHandle(), this->vertices.data(),
+                                       vertexCount, transform);
+}
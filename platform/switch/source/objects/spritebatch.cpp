@@ -0,0 +1,109 @@
+#include "objects/spritebatch/spritebatch.h"
+
+#include "deko3d/deko.h"
+#include "modules/graphics/graphics.h"
+
+using namespace love;
+
+SpriteBatch::SpriteBatch(Texture* texture, int size, vertex::Usage usage) :
+    common::SpriteBatch(texture, size, usage),
+    buffer(size * SPRITE_SIZE, alignof(vertex::Vertex), usage),
+    dirtyStart(-1),
+    dirtyEnd(-1)
+{
+    this->vertices.resize(size * VERTICES_PER_SPRITE);
+}
+
+SpriteBatch::~SpriteBatch()
+{}
+
+void SpriteBatch::SetBufferSize(int newSize)
+{
+    if (newSize <= 0)
+        throw love::Exception("Invalid SpriteBatch size.");
+
+    if (newSize == this->size)
+        return;
+
+    this->size = newSize;
+    this->next = std::min(this->next, newSize);
+
+    this->vertices.resize(newSize * VERTICES_PER_SPRITE);
+    this->buffer.resize(newSize * SPRITE_SIZE);
+
+    this->MarkDirty(0, this->next);
+}
+
+void SpriteBatch::MarkDirty(int start, int end)
+{
+    if (this->dirtyStart < 0)
+    {
+        this->dirtyStart = start;
+        this->dirtyEnd   = end;
+
+        return;
+    }
+
+    this->dirtyStart = std::min(this->dirtyStart, start);
+    this->dirtyEnd   = std::max(this->dirtyEnd, end);
+}
+
+int SpriteBatch::Add(Quad* quad, const Matrix4& transform, int index)
+{
+    int spriteIndex = this->GetAddIndex(index);
+
+    Vector2 transformed[VERTICES_PER_SPRITE];
+    transform.TransformXY(transformed, quad->GetVertexPositions(), VERTICES_PER_SPRITE);
+
+    const Vector2* texCoords    = quad->GetVertexTexCoords();
+    vertex::Vertex* sprite      = &this->vertices[spriteIndex * VERTICES_PER_SPRITE];
+    const vertex::Color8 packed = vertex::PackColor(this->color);
+
+    for (size_t i = 0; i < VERTICES_PER_SPRITE; i++)
+    {
+        sprite[i] = { { transformed[i].x, transformed[i].y },
+                      packed,
+                      { vertex::normto16t(texCoords[i].x), vertex::normto16t(texCoords[i].y) } };
+    }
+
+    this->MarkDirty(spriteIndex, spriteIndex + 1);
+
+    if (index == -1)
+        this->next++;
+
+    return spriteIndex;
+}
+
+void SpriteBatch::Flush()
+{
+    if (this->dirtyStart < 0)
+        return;
+
+    if (!this->buffer.update(this->vertices.data(), this->next * SPRITE_SIZE,
+                             this->dirtyStart * SPRITE_SIZE, this->dirtyEnd * SPRITE_SIZE))
+    {
+        throw love::Exception("Out of memory allocating SpriteBatch buffer.");
+    }
+
+    this->dirtyStart = this->dirtyEnd = -1;
+}
+
+void SpriteBatch::Draw(Graphics* gfx, const Matrix4& localTransform)
+{
+    int start = 0;
+    int count = 0;
+
+    this->GetDrawSpan(start, count);
+
+    if (count <= 0)
+        return;
+
+    this->Flush();
+
+    Matrix4 transform(gfx->GetTransform(), localTransform);
+    DkResHandle handle = this->texture->GetHandle();
+
+    ::deko3d::Instance().RenderBuffer(DkPrimitive_Quads, &handle, this->buffer.use(),
+                                      start * VERTICES_PER_SPRITE, count * VERTICES_PER_SPRITE,
+                                      transform);
+}
@@ -7,6 +7,8 @@ using namespace love;
 
 Text::Text(Font* font, const std::vector<Font::ColoredString>& text) :
     common::Text(font, text),
+    buffer(0, alignof(vertex::Vertex)),
+    dirty(false),
     vertexOffset(0),
     textureCacheId(-1)
 {
@@ -32,22 +34,28 @@ void Text::RegenerateVertices()
 
 void Text::CopyVertices(const std::vector<vertex::GlyphVertex>& vertices, size_t vertoffset)
 {
-    size_t offset   = vertoffset * sizeof(vertex::GlyphVertex);
-    size_t dataSize = vertices.size() * sizeof(vertex::GlyphVertex);
+    if (vertices.empty())
+        return;
 
-    if (dataSize > 0 &&
-        (this->vertexBuffer.empty() || (offset + dataSize) > this->vertexBuffer.size()))
-    {
-        size_t newSize = size_t((offset + dataSize) * 1.5);
+    this->vertices.resize(vertoffset + vertices.size());
 
-        if (!this->vertexBuffer.empty())
-            newSize = std::max(size_t(this->vertexBuffer.size() * 1.5), newSize);
+    vertex::Vertex* destination = &this->vertices[vertoffset];
+    vertex::GenerateTextureFromGlyphs(vertices.data(), vertices.size(), destination);
 
-        this->vertexBuffer.resize(newSize);
-    }
+    this->dirty = true;
+}
 
-    if (!this->vertexBuffer.empty() || dataSize > 0)
-        memcpy(this->vertexBuffer.data() + vertoffset, &vertices[0], dataSize);
+void Text::UploadVertices()
+{
+    uint32_t size = this->vertices.size() * sizeof(vertex::Vertex);
+
+    if (size > this->buffer.getCapacity())
+        this->buffer.resize(std::max<uint32_t>(this->buffer.getCapacity() * 1.5, size));
+
+    if (!this->buffer.update(this->vertices.data(), size, 0, size))
+        throw love::Exception("Out of memory allocating Text buffer.");
+
+    this->dirty = false;
 }
 
 void Text::AddTextData(const Text::TextData& text)
@@ -151,6 +159,7 @@ void Text::Clear()
 {
     this->textData.clear();
     this->drawCommands.clear();
+    this->vertices.clear();
     this->textureCacheId = this->font->GetTextureCacheID();
     this->vertexOffset   = 0;
 }
@@ -184,30 +193,35 @@ int Text::GetHeight(int index) const
     return this->textData[index].textInfo.height;
 }
 
+/*
+** The glyph quads stay on the GPU between frames
+** Drawing only uploads them again after the text changed,
+** the transform is applied by the vertex shader
+*/
 void Text::Draw(Graphics* gfx, const Matrix4& localTransform)
 {
-    if (this->drawCommands.empty() || this->vertexBuffer.empty())
-        return;
-
     if (this->font->GetTextureCacheID() != this->textureCacheId)
         this->RegenerateVertices();
 
-    int totalVertices = 0;
-    for (const Font::DrawCommand& command : this->drawCommands)
-        totalVertices = std::max(command.startVertex + command.vertexCount, totalVertices);
+    if (this->drawCommands.empty() || this->vertices.empty())
+        return;
 
-    Graphics::TempTransform transform(gfx, localTransform);
+    this->font->UploadGlyphs();
 
-    for (const Font::DrawCommand& command : this->drawCommands)
-    {
-        size_t vertexCount = command.vertexCount;
-        vertex::GlyphVertex vertexData[command.vertexCount];
+    if (this->dirty)
+        this->UploadVertices();
 
-        memcpy(vertexData, this->vertexBuffer.data(), sizeof(vertex::GlyphVertex) * vertexCount);
-        transform.TransformXY(vertexData, this->vertexBuffer.data(), vertexCount);
+    Matrix4 transform(gfx->GetTransform(), localTransform);
 
-        std::vector<vertex::Vertex> verts =
-            vertex::GenerateTextureFromGlyphs(vertexData, command.vertexCount);
-        ::deko3d::Instance().RenderTexture(command.texture->GetHandle(), verts.data(), vertexCount);
+    /* one draw per texture run, all sharing the same setup */
+    this->runs.clear();
+
+    for (const Font::DrawCommand& command : this->drawCommands)
+    {
+        this->runs.push_back({ command.texture->GetHandle(), (uint32_t)command.startVertex,
+                               (uint32_t)command.vertexCount });
     }
+
+    ::deko3d::Instance().RenderBufferRuns(DkPrimitive_Quads, this->buffer.use(), this->runs,
+                                          transform);
 }
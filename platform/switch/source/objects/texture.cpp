@@ -34,9 +34,17 @@ bool Texture::SetWrap(const Wrap& wrap)
 
 void Texture::SetFilter(const Filter& filter)
 {
+    this->filter = filter;
     ::deko3d::Instance().SetTextureFilter(this, filter);
 }
 
+void Texture::SetSwizzle(DkImageSwizzle red, DkImageSwizzle green, DkImageSwizzle blue,
+                         DkImageSwizzle alpha)
+{
+    this->texture.setSwizzle(red, green, blue, alpha);
+    ::deko3d::Instance().UpdateResHandle(this->handle, this->texture.getDescriptor());
+}
+
 void Texture::Draw(Graphics* gfx, const Matrix4& localTransform)
 {
     this->Draw(gfx, this->quad, localTransform);
@@ -44,31 +52,63 @@ void Texture::Draw(Graphics* gfx, const Matrix4& localTransform)
 
 void Texture::Draw(Graphics* gfx, love::Quad* quad, const Matrix4& localTransform)
 {
-    const Matrix4& tm  = gfx->GetTransform();
-    bool is2D          = tm.IsAffine2DTransform();
     const Colorf color = gfx->GetColor();
 
-    Matrix4 t(tm, localTransform);
-
     /* zero out a new vertex data thing */
     vertex::Vertex vertexData[TEXTURE_QUAD_POINT_COUNT];
     std::fill_n(vertexData, TEXTURE_QUAD_POINT_COUNT, vertex::Vertex {});
 
     Vector2 transformed[TEXTURE_QUAD_POINT_COUNT];
-    std::fill_n(transformed, TEXTURE_QUAD_POINT_COUNT, Vector2 {});
+    Matrix4 t = ::deko3d::SplitTransform(gfx->GetTransform(), localTransform, transformed,
+                                         quad->GetVertexPositions(), TEXTURE_QUAD_POINT_COUNT);
 
-    if (is2D)
-        t.TransformXY(transformed, quad->GetVertexPositions(), TEXTURE_QUAD_POINT_COUNT);
+    const Vector2* texCoords    = quad->GetVertexTexCoords();
+    const vertex::Color8 packed = vertex::PackColor(color);
 
-    const Vector2* texCoords = quad->GetVertexTexCoords();
+    for (size_t i = 0; i < TEXTURE_QUAD_POINT_COUNT; i++)
+    {
+        vertexData[i] = { { transformed[i].x, transformed[i].y },
+                          packed,
+                          { vertex::normto16t(texCoords[i].x),
+                            vertex::normto16t(texCoords[i].y) } };
+    }
+
+    ::deko3d::Instance().RenderTexture(this->handle, vertexData, TEXTURE_QUAD_POINT_COUNT, t);
+}
+
+void Texture::DrawInstanced(Graphics* gfx, InstanceBuffer* instances, int count,
+                            const Matrix4& localTransform)
+{
+    count = std::min(count, (int)instances->GetCount());
+
+    if (count <= 0)
+        return;
+
+    const Vector2* positions = this->quad->GetVertexPositions();
+    const Vector2* texCoords = this->quad->GetVertexTexCoords();
+
+    const vertex::Color8 packed = vertex::PackColor(gfx->GetColor());
+
+    /*
+    ** The instances place the quad, so it stays in local space
+    ** Each one shrinks it to the part of the texture it shows
+    */
+    vertex::Vertex vertexData[TEXTURE_QUAD_POINT_COUNT];
 
     for (size_t i = 0; i < TEXTURE_QUAD_POINT_COUNT; i++)
     {
-        vertexData[i] = { { transformed[i].x, transformed[i].y, 0.0f },
-                          { color.r, color.g, color.b, color.a },
+        vertexData[i] = { { positions[i].x, positions[i].y },
+                          packed,
                           { vertex::normto16t(texCoords[i].x),
                             vertex::normto16t(texCoords[i].y) } };
     }
 
-    ::deko3d::Instance().RenderTexture(this->handle, vertexData, TEXTURE_QUAD_POINT_COUNT);
+    instances->Flush();
+
+    ::deko3d::Instances instanceData = { &instances->UseBuffer(), 0, (uint32_t)count };
+
+    Matrix4 transform(gfx->GetTransform(), localTransform);
+
+    ::deko3d::Instance().RenderInstanced(DkPrimitive_Quads, &this->handle, vertexData,
+                                         TEXTURE_QUAD_POINT_COUNT, transform, instanceData);
 }
@@ -12,18 +12,20 @@ Video::Video(Graphics* graphics, VideoStream* stream, float dpiScale) :
 {
     std::fill_n(this->vertices, 4, vertex::Vertex {});
 
-    this->vertices[0] = { .position = { 0, 0 }, .color = { 1, 1, 1, 1 }, .texcoord = { 0, 0 } };
+    this->vertices[0] = { .position = { 0, 0 },
+                          .color    = { 0xFF, 0xFF, 0xFF, 0xFF },
+                          .texcoord = { 0, 0 } };
 
     this->vertices[1] = { .position = { 0, (float)this->height },
-                          .color    = { 1, 1, 1, 1 },
+                          .color    = { 0xFF, 0xFF, 0xFF, 0xFF },
                           .texcoord = { 0, 1 } };
 
     this->vertices[2] = { .position = { (float)this->width, (float)this->height },
-                          .color    = { 1, 1, 1, 1 },
+                          .color    = { 0xFF, 0xFF, 0xFF, 0xFF },
                           .texcoord = { 1, 1 } };
 
     this->vertices[3] = { .position = { (float)this->width, 0 },
-                          .color    = { 1, 1, 1, 1 },
+                          .color    = { 0xFF, 0xFF, 0xFF, 0xFF },
                           .texcoord = { 1, 0 } };
 
     auto frame = (const TheoraStream::Frame*)this->stream->GetFrontBuffer();
@@ -85,38 +87,33 @@ void Video::Draw(Graphics* graphics, const Matrix4& localTransform)
 {
     this->Update();
 
-    const Matrix4& tm  = graphics->GetTransform();
-    bool is2D          = tm.IsAffine2DTransform();
     const Colorf color = graphics->GetColor();
 
-    Matrix4 t(tm, localTransform);
-
     vertex::Vertex vertexData[4];
     std::fill_n(vertexData, 4, vertex::Vertex {});
 
     Vector2 transformed[4];
-    std::fill_n(transformed, 4, Vector2 {});
-
     Vector2 positions[4];
 
-    std::fill_n(positions, 4, Vector2 {});
     for (size_t index = 0; index < 4; index++)
         positions[index] =
             Vector2(this->vertices[index].position[0], this->vertices[index].position[1]);
 
-    if (is2D)
-        t.TransformXY(transformed, positions, 4);
+    Matrix4 t = ::deko3d::SplitTransform(graphics->GetTransform(), localTransform, transformed,
+                                         positions, 4);
 
     DkResHandle handles[3] = { this->images[0]->GetHandle(), this->images[1]->GetHandle(),
                                this->images[2]->GetHandle() };
 
+    const vertex::Color8 packed = vertex::PackColor(color);
+
     for (size_t i = 0; i < 4; i++)
     {
-        vertexData[i] = { { transformed[i].x, transformed[i].y, 0.0f },
-                          { color.r, color.g, color.b, color.a },
+        vertexData[i] = { { transformed[i].x, transformed[i].y },
+                          packed,
                           { vertex::normto16t(this->vertices[i].texcoord[0]),
                             vertex::normto16t(this->vertices[i].texcoord[1]) } };
     }
 
-    ::deko3d::Instance().RenderVideo(handles, vertexData, 4);
+    ::deko3d::Instance().RenderVideo(handles, vertexData, 4, t);
 }
@@ -0,0 +1,137 @@
+#include "objects/instancebuffer/wrap_instancebuffer.h"
+
+#include "objects/quad/wrap_quad.h"
+
+using namespace love;
+
+int Wrap_InstanceBuffer::SetInstance(lua_State* L)
+{
+    InstanceBuffer* self = Wrap_InstanceBuffer::CheckInstanceBuffer(L, 1);
+    size_t index         = (size_t)luaL_checkinteger(L, 2) - 1;
+
+    float x     = luaL_checknumber(L, 3);
+    float y     = luaL_checknumber(L, 4);
+    float angle = luaL_optnumber(L, 5, 0.0);
+    float sx    = luaL_optnumber(L, 6, 1.0);
+    float sy    = luaL_optnumber(L, 7, sx);
+
+    Luax::CatchException(L, [&]() { self->SetInstance(index, x, y, angle, sx, sy); });
+
+    return 0;
+}
+
+int Wrap_InstanceBuffer::GetInstance(lua_State* L)
+{
+    InstanceBuffer* self = Wrap_InstanceBuffer::CheckInstanceBuffer(L, 1);
+    size_t index         = (size_t)luaL_checkinteger(L, 2) - 1;
+
+    const vertex::Instance* instance = nullptr;
+    Luax::CatchException(L, [&]() { instance = &self->GetInstance(index); });
+
+    lua_pushnumber(L, instance->offset[0]);
+    lua_pushnumber(L, instance->offset[1]);
+    lua_pushnumber(L, instance->rotation);
+    lua_pushnumber(L, instance->scale[0]);
+    lua_pushnumber(L, instance->scale[1]);
+
+    return 5;
+}
+
+int Wrap_InstanceBuffer::SetColor(lua_State* L)
+{
+    InstanceBuffer* self = Wrap_InstanceBuffer::CheckInstanceBuffer(L, 1);
+    size_t index         = (size_t)luaL_checkinteger(L, 2) - 1;
+
+    Colorf color = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+    if (lua_istable(L, 3))
+    {
+        for (int i = 1; i <= 4; i++)
+            lua_rawgeti(L, 3, i);
+
+        color.r = luaL_checknumber(L, -4);
+        color.g = luaL_checknumber(L, -3);
+        color.b = luaL_checknumber(L, -2);
+        color.a = luaL_optnumber(L, -1, 1.0f);
+
+        lua_pop(L, 4);
+    }
+    else
+    {
+        color.r = luaL_checknumber(L, 3);
+        color.g = luaL_checknumber(L, 4);
+        color.b = luaL_checknumber(L, 5);
+        color.a = luaL_optnumber(L, 6, 1.0f);
+    }
+
+    Luax::CatchException(L, [&]() { self->SetColor(index, color); });
+
+    return 0;
+}
+
+int Wrap_InstanceBuffer::GetColor(lua_State* L)
+{
+    InstanceBuffer* self = Wrap_InstanceBuffer::CheckInstanceBuffer(L, 1);
+    size_t index         = (size_t)luaL_checkinteger(L, 2) - 1;
+
+    const vertex::Instance* instance = nullptr;
+    Luax::CatchException(L, [&]() { instance = &self->GetInstance(index); });
+
+    for (size_t i = 0; i < 4; i++)
+        lua_pushnumber(L, instance->color[i] / 255.0f);
+
+    return 4;
+}
+
+int Wrap_InstanceBuffer::SetQuad(lua_State* L)
+{
+    InstanceBuffer* self = Wrap_InstanceBuffer::CheckInstanceBuffer(L, 1);
+    size_t index         = (size_t)luaL_checkinteger(L, 2) - 1;
+    Quad* quad           = Wrap_Quad::CheckQuad(L, 3);
+
+    Luax::CatchException(L, [&]() { self->SetQuad(index, quad); });
+
+    return 0;
+}
+
+int Wrap_InstanceBuffer::GetCount(lua_State* L)
+{
+    InstanceBuffer* self = Wrap_InstanceBuffer::CheckInstanceBuffer(L, 1);
+
+    lua_pushinteger(L, self->GetCount());
+
+    return 1;
+}
+
+int Wrap_InstanceBuffer::Flush(lua_State* L)
+{
+    InstanceBuffer* self = Wrap_InstanceBuffer::CheckInstanceBuffer(L, 1);
+
+    self->Flush();
+
+    return 0;
+}
+
+InstanceBuffer* Wrap_InstanceBuffer::CheckInstanceBuffer(lua_State* L, int index)
+{
+    return Luax::CheckType<InstanceBuffer>(L, index);
+}
+
+// clang-format off
+static constexpr luaL_Reg functions[] =
+{
+    { "flush",       Wrap_InstanceBuffer::Flush       },
+    { "getColor",    Wrap_InstanceBuffer::GetColor    },
+    { "getCount",    Wrap_InstanceBuffer::GetCount    },
+    { "getInstance", Wrap_InstanceBuffer::GetInstance },
+    { "setColor",    Wrap_InstanceBuffer::SetColor    },
+    { "setInstance", Wrap_InstanceBuffer::SetInstance },
+    { "setQuad",     Wrap_InstanceBuffer::SetQuad     },
+    { 0,             0                                }
+};
+// clang-format on
+
+int Wrap_InstanceBuffer::Register(lua_State* L)
+{
+    return Luax::RegisterType(L, &InstanceBuffer::type, functions, nullptr);
+}
@@ -0,0 +1,389 @@
+#include "objects/mesh/wrap_mesh.h"
+
+#include "objects/texture/wrap_texture.h"
+
+using namespace love;
+
+/*
+** Fill @vertex from consecutive values, fetched by @get
+** Missing components take the LÖVE defaults
+*/
+template<typename T>
+static vertex::Vertex ReadVertex(lua_State* L, const std::vector<Mesh::AttributeFormat>& format,
+                                 const T& get)
+{
+    vertex::Vertex result = { .position = { 0.0f, 0.0f },
+                              .color    = { 0xFF, 0xFF, 0xFF, 0xFF },
+                              .texcoord = { 0, 0 } };
+
+    int component = 1;
+
+    for (const Mesh::AttributeFormat& attribute : format)
+    {
+        for (int index = 0; index < attribute.components; index++, component++)
+        {
+            get(component);
+
+            switch (attribute.type)
+            {
+                case Mesh::ATTRIB_POSITION:
+                    result.position[index] = luaL_optnumber(L, -1, 0.0);
+                    break;
+                case Mesh::ATTRIB_TEXCOORD:
+                    result.texcoord[index] = vertex::normto16t(luaL_optnumber(L, -1, 0.0));
+                    break;
+                case Mesh::ATTRIB_COLOR:
+                    result.color[index] = vertex::normto8t(luaL_optnumber(L, -1, 1.0));
+                    break;
+                default:
+                    break;
+            }
+
+            lua_pop(L, 1);
+        }
+    }
+
+    return result;
+}
+
+vertex::Vertex Wrap_Mesh::CheckVertex(lua_State* L, int index,
+                                      const std::vector<Mesh::AttributeFormat>& format)
+{
+    luaL_checktype(L, index, LUA_TTABLE);
+
+    return ReadVertex(L, format, [&](int component) { lua_rawgeti(L, index, component); });
+}
+
+void Wrap_Mesh::CheckVertexFormat(lua_State* L, int index,
+                                  std::vector<Mesh::AttributeFormat>& out)
+{
+    luaL_checktype(L, index, LUA_TTABLE);
+
+    size_t length = lua_objlen(L, index);
+
+    for (size_t i = 1; i <= length; i++)
+    {
+        lua_rawgeti(L, index, i);
+        luaL_checktype(L, -1, LUA_TTABLE);
+
+        for (int j = 1; j <= 3; j++)
+            lua_rawgeti(L, -j, j);
+
+        const char* name = luaL_checkstring(L, -3);
+        int components   = (int)luaL_checkinteger(L, -1);
+
+        Mesh::AttributeType type;
+        if (!Mesh::GetConstant(name, type))
+            luaL_error(L, "Custom vertex attribute '%s' is not supported on this console.", name);
+
+        int maxComponents = 2;
+
+        if (type == Mesh::ATTRIB_COLOR)
+            maxComponents = 4;
+
+        if (components < 1 || components > maxComponents)
+            luaL_error(L, "Invalid component count for vertex attribute '%s'.", name);
+
+        out.push_back({ type, components });
+
+        lua_pop(L, 4);
+    }
+}
+
+int Wrap_Mesh::SetVertex(lua_State* L)
+{
+    Mesh* self   = Wrap_Mesh::CheckMesh(L, 1);
+    size_t index = (size_t)luaL_checkinteger(L, 2) - 1;
+
+    const auto& format = self->GetVertexFormat();
+    vertex::Vertex vertex;
+
+    if (lua_istable(L, 3))
+        vertex = Wrap_Mesh::CheckVertex(L, 3, format);
+    else
+        vertex = ReadVertex(L, format, [&](int component) { lua_pushvalue(L, 2 + component); });
+
+    Luax::CatchException(L, [&]() { self->SetVertex(index, vertex); });
+
+    return 0;
+}
+
+int Wrap_Mesh::GetVertex(lua_State* L)
+{
+    Mesh* self   = Wrap_Mesh::CheckMesh(L, 1);
+    size_t index = (size_t)luaL_checkinteger(L, 2) - 1;
+
+    const vertex::Vertex* vertex = nullptr;
+    Luax::CatchException(L, [&]() { vertex = &self->GetVertex(index); });
+
+    int count = 0;
+
+    for (const Mesh::AttributeFormat& attribute : self->GetVertexFormat())
+    {
+        for (int i = 0; i < attribute.components; i++, count++)
+        {
+            if (attribute.type == Mesh::ATTRIB_POSITION)
+                lua_pushnumber(L, vertex->position[i]);
+            else if (attribute.type == Mesh::ATTRIB_TEXCOORD)
+                lua_pushnumber(L, vertex->texcoord[i] / (float)0xFFFF);
+            else
+                lua_pushnumber(L, vertex->color[i] / 255.0f);
+        }
+    }
+
+    return count;
+}
+
+int Wrap_Mesh::SetVertices(lua_State* L)
+{
+    Mesh* self   = Wrap_Mesh::CheckMesh(L, 1);
+    size_t start = (size_t)luaL_optinteger(L, 3, 1) - 1;
+
+    luaL_checktype(L, 2, LUA_TTABLE);
+
+    const auto& format = self->GetVertexFormat();
+    size_t count       = lua_objlen(L, 2);
+
+    std::vector<vertex::Vertex> vertices;
+    vertices.reserve(count);
+
+    for (size_t index = 1; index <= count; index++)
+    {
+        lua_rawgeti(L, 2, index);
+        vertices.push_back(Wrap_Mesh::CheckVertex(L, -1, format));
+        lua_pop(L, 1);
+    }
+
+    Luax::CatchException(L, [&]() { self->SetVertices(start, vertices); });
+
+    return 0;
+}
+
+int Wrap_Mesh::GetVertexCount(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    lua_pushinteger(L, self->GetVertexCount());
+
+    return 1;
+}
+
+int Wrap_Mesh::GetVertexFormat(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    const auto& format = self->GetVertexFormat();
+    lua_createtable(L, format.size(), 0);
+
+    for (size_t index = 0; index < format.size(); index++)
+    {
+        const char* name = nullptr;
+        Mesh::GetConstant(format[index].type, name);
+
+        lua_createtable(L, 3, 0);
+
+        lua_pushstring(L, name);
+        lua_rawseti(L, -2, 1);
+
+        lua_pushstring(L, "float");
+        lua_rawseti(L, -2, 2);
+
+        lua_pushinteger(L, format[index].components);
+        lua_rawseti(L, -2, 3);
+
+        lua_rawseti(L, -2, index + 1);
+    }
+
+    return 1;
+}
+
+int Wrap_Mesh::SetVertexMap(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    if (lua_isnoneornil(L, 2))
+    {
+        self->SetVertexMap();
+        return 0;
+    }
+
+    std::vector<uint32_t> map;
+
+    if (lua_istable(L, 2))
+    {
+        size_t count = lua_objlen(L, 2);
+        map.reserve(count);
+
+        for (size_t index = 1; index <= count; index++)
+        {
+            lua_rawgeti(L, 2, index);
+            map.push_back((uint32_t)luaL_checkinteger(L, -1) - 1);
+            lua_pop(L, 1);
+        }
+    }
+    else
+    {
+        int count = lua_gettop(L) - 1;
+        map.reserve(count);
+
+        for (int index = 0; index < count; index++)
+            map.push_back((uint32_t)luaL_checkinteger(L, index + 2) - 1);
+    }
+
+    Luax::CatchException(L, [&]() { self->SetVertexMap(map); });
+
+    return 0;
+}
+
+int Wrap_Mesh::GetVertexMap(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    std::vector<uint32_t> map;
+
+    if (!self->GetVertexMap(map))
+    {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    lua_createtable(L, map.size(), 0);
+
+    for (size_t index = 0; index < map.size(); index++)
+    {
+        lua_pushinteger(L, map[index] + 1);
+        lua_rawseti(L, -2, index + 1);
+    }
+
+    return 1;
+}
+
+int Wrap_Mesh::SetTexture(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    if (lua_isnoneornil(L, 2))
+        self->SetTexture();
+    else
+    {
+        Texture* texture = Wrap_Texture::CheckTexture(L, 2);
+        self->SetTexture(texture);
+    }
+
+    return 0;
+}
+
+int Wrap_Mesh::GetTexture(lua_State* L)
+{
+    Mesh* self       = Wrap_Mesh::CheckMesh(L, 1);
+    Texture* texture = self->GetTexture();
+
+    if (texture == nullptr)
+        return 0;
+
+    Luax::PushType(L, texture);
+
+    return 1;
+}
+
+int Wrap_Mesh::SetDrawMode(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    Mesh::DrawMode mode;
+    const char* modeStr = luaL_checkstring(L, 2);
+
+    if (!Mesh::GetConstant(modeStr, mode))
+        return Luax::EnumError(L, "mesh draw mode", Mesh::GetConstants(mode), modeStr);
+
+    self->SetDrawMode(mode);
+
+    return 0;
+}
+
+int Wrap_Mesh::GetDrawMode(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    const char* modeStr = nullptr;
+
+    if (!Mesh::GetConstant(self->GetDrawMode(), modeStr))
+        return luaL_error(L, "Unknown mesh draw mode.");
+
+    lua_pushstring(L, modeStr);
+
+    return 1;
+}
+
+int Wrap_Mesh::SetDrawRange(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    if (lua_isnoneornil(L, 2))
+        self->SetDrawRange();
+    else
+    {
+        int start = (int)luaL_checkinteger(L, 2) - 1;
+        int count = (int)luaL_checkinteger(L, 3);
+
+        Luax::CatchException(L, [&]() { self->SetDrawRange(start, count); });
+    }
+
+    return 0;
+}
+
+int Wrap_Mesh::GetDrawRange(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    int start = 0;
+    int count = 1;
+
+    if (!self->GetDrawRange(start, count))
+        return 0;
+
+    lua_pushinteger(L, start + 1);
+    lua_pushinteger(L, count);
+
+    return 2;
+}
+
+int Wrap_Mesh::Flush(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    self->Flush();
+
+    return 0;
+}
+
+Mesh* Wrap_Mesh::CheckMesh(lua_State* L, int index)
+{
+    return Luax::CheckType<Mesh>(L, index);
+}
+
+// clang-format off
+static constexpr luaL_Reg functions[] =
+{
+    { "flush",           Wrap_Mesh::Flush           },
+    { "getDrawMode",     Wrap_Mesh::GetDrawMode     },
+    { "getDrawRange",    Wrap_Mesh::GetDrawRange    },
+    { "getTexture",      Wrap_Mesh::GetTexture      },
+    { "getVertex",       Wrap_Mesh::GetVertex       },
+    { "getVertexCount",  Wrap_Mesh::GetVertexCount  },
+    { "getVertexFormat", Wrap_Mesh::GetVertexFormat },
+    { "getVertexMap",    Wrap_Mesh::GetVertexMap    },
+    { "setDrawMode",     Wrap_Mesh::SetDrawMode     },
+    { "setDrawRange",    Wrap_Mesh::SetDrawRange    },
+    { "setTexture",      Wrap_Mesh::SetTexture      },
+    { "setVertex",       Wrap_Mesh::SetVertex       },
+    { "setVertexMap",    Wrap_Mesh::SetVertexMap    },
+    { "setVertices",     Wrap_Mesh::SetVertices     },
+    { 0,                 0                          }
+};
+// clang-format on
+
+int Wrap_Mesh::Register(lua_State* L)
+{
+    return Luax::RegisterType(L, &Mesh::type, functions, nullptr);
+}
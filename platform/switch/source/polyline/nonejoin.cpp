@@ -5,13 +5,13 @@ void NoneJoinPolyline::CalculateOverdrawVertexCount(bool /* isLooping */)
     this->overdrawVertexCount = 4 * (this->vertexCount - 2);
 }
 
-void NoneJoinPolyline::FillColorArray(Colorf constant_color, Colorf* colors, int count)
+void NoneJoinPolyline::FillColorArray(const vertex::Color8& constantColor,
+                                      vertex::Vertex* vertices, int count)
 {
     for (int i = 0; i < count; ++i)
     {
-        Colorf c = constant_color;
-        c.a *= (i & 3) < 2; // if (i % 4 == 2 || i % 4 == 3) c.a = 0
-        colors[i] = c;
+        vertices[i].color = constantColor;
+        vertices[i].color[3] *= (i & 3) < 2; // if (i % 4 == 2 || i % 4 == 3) c.a = 0
     }
 }
 
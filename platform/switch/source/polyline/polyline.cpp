@@ -7,36 +7,30 @@
 
 using namespace love;
 
-Polyline::~Polyline()
-{
-    if (this->vertices)
-        delete[] this->vertices;
-}
-
 void Polyline::CalculateOverdrawVertexCount(bool isLooping)
 {
     this->overdrawVertexCount = 2 * this->vertexCount + (isLooping ? 0 : 2);
 }
 
-void Polyline::FillColorArray(Colorf constantColor, Colorf* colors, int count)
+void Polyline::FillColorArray(const vertex::Color8& constantColor, vertex::Vertex* vertices,
+                              int count)
 {
     for (int i = 0; i < count; ++i)
     {
-        Colorf color = constantColor;
-        color.a *= (i + 1) % 2; // avoids branching. equiv to if (i%2 == 1) c.a = 0;
-
-        colors[i] = color;
+        vertices[i].color = constantColor;
+        vertices[i].color[3] *= (i + 1) % 2; // avoids branching. equiv to if (i%2 == 1) c.a = 0;
     }
 }
 
 void Polyline::Render(const Vector2* coords, size_t count, size_t sizeHint, float halfWidth,
                       float pixelSize, bool drawOverdraw)
 {
-    static std::vector<Vector2> anchors;
+    /* clearing keeps the capacity from earlier lines */
+    std::vector<Vector2>& anchors = this->arena.anchors;
     anchors.clear();
     anchors.reserve(sizeHint);
 
-    static std::vector<Vector2> normals;
+    std::vector<Vector2>& normals = this->arena.normals;
     normals.clear();
     normals.reserve(sizeHint);
 
@@ -81,7 +75,8 @@ void Polyline::Render(const Vector2* coords, size_t count, size_t sizeHint, floa
             extraVertices = 2;
     }
 
-    this->vertices = new Vector2[this->vertexCount + extraVertices + this->overdrawVertexCount];
+    this->arena.vertices.resize(this->vertexCount + extraVertices + this->overdrawVertexCount);
+    this->vertices = this->arena.vertices.data();
 
     for (size_t i = 0; i < this->vertexCount; ++i)
         this->vertices[i] = anchors[i] + normals[i];
@@ -152,10 +147,10 @@ void Polyline::RenderOverdraw(const std::vector<Vector2>& normals, float pixelSi
 
 void Polyline::Draw(Graphics* graphics)
 {
+    /* the vertex shader applies the transform */
     const Matrix4& t = graphics->GetTransform();
-    bool is2D        = t.IsAffine2DTransform();
 
-    Colorf currentColor = graphics->GetColor();
+    const vertex::Color8 color = vertex::PackColor(graphics->GetColor());
 
     int overdrawStart = (int)this->overdrawVertexStart;
     int overdrawCount = (int)this->overdrawVertexCount;
@@ -176,22 +171,21 @@ void Polyline::Draw(Graphics* graphics)
         const Vector2* verts = this->vertices + vertexStart;
         int cmdVertexCount   = std::min(maxVertices, totalVertexCount - vertexStart);
 
-        /* make vector2 array - size to cmd.vertexCount */
-        Vector2 transformed[cmdVertexCount];
-        std::fill_n(transformed, cmdVertexCount, Vector2 {});
+        /* write the final vertices straight into the vertex ring */
+        vertex::Vertex* vertices =
+            ::deko3d::Instance().ReserveVertices(this->triangleMode, cmdVertexCount, t);
 
-        if (is2D)
-            t.TransformXY(transformed, verts, cmdVertexCount);
+        if (vertices == nullptr)
+            return;
 
-        /* make colorf array - size to cmd.vertexCount */
-        Colorf colors[cmdVertexCount];
-        std::fill_n(colors, cmdVertexCount, Colorf {});
+        for (int i = 0; i < cmdVertexCount; i++)
+            vertices[i] = { { verts[i].x, verts[i].y }, vertex::Color8 {}, { 0, 0 } };
 
         int drawRoughCount = std::min(cmdVertexCount, (int)this->vertexCount - vertexStart);
 
         /* Constant vertex color up to the overdraw vertices. */
         for (int i = 0; i < drawRoughCount; i++)
-            colors[i] = currentColor;
+            vertices[i].color = color;
 
         if (this->overdraw)
         {
@@ -206,15 +200,9 @@ void Polyline::Draw(Graphics* graphics)
                 std::min(drawRemainingCount, drawOverdrawEnd - drawOverdrawBegin);
 
             if (drawOverdrawCount > 0)
-            {
-                Colorf* colordata = colors + drawOverdrawBegin;
-                this->FillColorArray(currentColor, colordata, drawOverdrawCount);
-            }
+                this->FillColorArray(color, vertices + drawOverdrawBegin, drawOverdrawCount);
         }
 
-        auto render = vertex::GeneratePrimitiveFromVectors(std::span(transformed, cmdVertexCount),
-                                                           std::span(colors, cmdVertexCount));
-
-        ::deko3d::Instance().RenderPolyline(this->triangleMode, render.get(), cmdVertexCount);
+        ::deko3d::Instance().CommitVertices(cmdVertexCount);
     }
 }
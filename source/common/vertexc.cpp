@@ -0,0 +1,26 @@
+#include "common/vertexc.h"
+
+#include "common/bidirectionalmap.h"
+
+// clang-format off
+constexpr auto usages = BidirectionalMap<>::Create(
+    "stream",  vertex::Usage::USAGE_STREAM,
+    "dynamic", vertex::Usage::USAGE_DYNAMIC,
+    "static",  vertex::Usage::USAGE_STATIC
+);
+// clang-format on
+
+bool vertex::GetConstant(const char* in, Usage& out)
+{
+    return usages.Find(in, out);
+}
+
+bool vertex::GetConstant(Usage in, const char*& out)
+{
+    return usages.ReverseFind(in, out);
+}
+
+std::vector<const char*> vertex::GetConstants(Usage)
+{
+    return usages.GetNames();
+}
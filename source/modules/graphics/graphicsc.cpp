@@ -229,6 +229,18 @@ const Texture::Filter& Graphics::GetDefaultFilter() const
     return Texture::defaultFilter;
 }
 
+Graphics::Stats Graphics::GetStats() const
+{
+    Stats stats {};
+
+    stats.canvases      = Canvas::canvasCount;
+    stats.images        = Image::imageCount;
+    stats.fonts         = Font::fontCount;
+    stats.textureMemory = Texture::totalGraphicsMemory;
+
+    return stats;
+}
+
 void Graphics::Origin()
 {
     auto& transform = this->transformStack.back();
@@ -324,9 +336,9 @@ Image* Graphics::NewImage(Texture::TextureType t, PixelFormat format, int width,
     return new Image(t, format, width, height, slices);
 }
 
-Image* Graphics::NewImage(const Image::Slices& data)
+Image* Graphics::NewImage(const Image::Slices& data, const Image::Settings& settings)
 {
-    return new Image(data);
+    return new Image(data, settings);
 }
 
 Quad* Graphics::NewQuad(Quad::Viewport viewport, double sw, double sh)
@@ -339,6 +351,30 @@ Text* Graphics::NewText(Font* font, const std::vector<Font::ColoredString>& text
     return new Text(font, text);
 }
 
+SpriteBatch* Graphics::NewSpriteBatch(Texture* texture, int size, vertex::Usage usage)
+{
+    return new SpriteBatch(texture, size, usage);
+}
+
+ParticleSystem* Graphics::NewParticleSystem(Texture* texture, uint32_t size)
+{
+    return new ParticleSystem(texture, size);
+}
+
+#if defined(__SWITCH__)
+Mesh* Graphics::NewMesh(const std::vector<Mesh::AttributeFormat>& format,
+                        const std::vector<vertex::Vertex>& vertices, Mesh::DrawMode mode,
+                        vertex::Usage usage)
+{
+    return new Mesh(format, vertices, mode, usage);
+}
+
+InstanceBuffer* Graphics::NewInstanceBuffer(size_t size, vertex::Usage usage)
+{
+    return new InstanceBuffer(size, usage);
+}
+#endif
+
 Canvas* Graphics::NewCanvas(const Canvas::Settings& settings)
 {
     return new Canvas(settings);
@@ -356,6 +392,20 @@ void Graphics::Draw(Texture* texture, Quad* quad, const Matrix4& matrix)
     texture->Draw(this, quad, matrix);
 }
 
+#if defined(__SWITCH__)
+void Graphics::DrawInstanced(Mesh* mesh, InstanceBuffer* instances, int count,
+                             const Matrix4& matrix)
+{
+    mesh->DrawInstanced(this, instances, count, matrix);
+}
+
+void Graphics::DrawInstanced(Texture* texture, InstanceBuffer* instances, int count,
+                             const Matrix4& matrix)
+{
+    texture->DrawInstanced(this, instances, count, matrix);
+}
+#endif
+
 void Graphics::Print(const std::vector<Font::ColoredString>& strings, const Matrix4& localTransform)
 {
     this->CheckSetDefaultFont();
@@ -843,12 +843,12 @@ static std::pair<StrongReference<ImageData>, StrongReference<CompressedImageData
     return std::make_pair(imageData, cData);
 }
 
-static int _pushNewImage(lua_State* L, Image::Slices& slices)
+static int _pushNewImage(lua_State* L, Image::Slices& slices, const Image::Settings& settings)
 {
     StrongReference<Image> image;
 
     Luax::CatchException(
-        L, [&]() { image.Set(instance()->NewImage(slices), Acquire::NORETAIN); },
+        L, [&]() { image.Set(instance()->NewImage(slices, settings), Acquire::NORETAIN); },
         [&](bool) { slices.Clear(); });
 
     Luax::PushType(L, image);
@@ -882,12 +882,17 @@ int Wrap_Graphics::NewImage(lua_State* L)
     float dpiScale = 1.0f;
     auto data      = getImageData(L, 1, true, &dpiScale);
 
+    Image::Settings settings;
+
+    if (lua_istable(L, 2))
+        settings.mipmaps = Luax::BoolFlag(L, 2, "mipmaps", settings.mipmaps);
+
     if (data.first.Get())
         slices.Set(0, 0, data.first);
     else
-        slices.Add(data.second, 0, 0, false, false);
+        slices.Add(data.second, 0, 0, false, true);
 
-    return _pushNewImage(L, slices);
+    return _pushNewImage(L, slices, settings);
 }
 
 int Wrap_Graphics::NewText(lua_State* L)
@@ -911,6 +916,155 @@ int Wrap_Graphics::NewText(lua_State* L)
     return 1;
 }
 
+int Wrap_Graphics::NewSpriteBatch(lua_State* L)
+{
+    Texture* texture = Wrap_Texture::CheckTexture(L, 1);
+    int size         = (int)luaL_optinteger(L, 2, SpriteBatch::DEFAULT_SIZE);
+
+    vertex::Usage usage = vertex::USAGE_DYNAMIC;
+
+    if (!lua_isnoneornil(L, 3))
+    {
+        const char* usageStr = luaL_checkstring(L, 3);
+
+        if (!vertex::GetConstant(usageStr, usage))
+            return Luax::EnumError(L, "usage hint", vertex::GetConstants(usage), usageStr);
+    }
+
+    SpriteBatch* batch = nullptr;
+
+    Luax::CatchException(L,
+                         [&]() { batch = instance()->NewSpriteBatch(texture, size, usage); });
+
+    Luax::PushType(L, batch);
+    batch->Release();
+
+    return 1;
+}
+
+int Wrap_Graphics::NewParticleSystem(lua_State* L)
+{
+    Texture* texture = Wrap_Texture::CheckTexture(L, 1);
+    lua_Number size  = luaL_optnumber(L, 2, 1000);
+
+    if (size < 1.0 || size > ParticleSystem::MAX_PARTICLES)
+        return luaL_error(L, "Invalid ParticleSystem size");
+
+    ParticleSystem* system = nullptr;
+
+    Luax::CatchException(
+        L, [&]() { system = instance()->NewParticleSystem(texture, (uint32_t)size); });
+
+    Luax::PushType(L, system);
+    system->Release();
+
+    return 1;
+}
+
+#if defined(__SWITCH__)
+int Wrap_Graphics::NewMesh(lua_State* L)
+{
+    std::vector<Mesh::AttributeFormat> format = Mesh::GetDefaultFormat();
+    int start                                 = 1;
+
+    /* newMesh(format, vertices | count, ...) */
+    if (lua_istable(L, 1) && (lua_istable(L, 2) || lua_isnumber(L, 2)))
+    {
+        format.clear();
+        Wrap_Mesh::CheckVertexFormat(L, 1, format);
+
+        start = 2;
+    }
+
+    std::vector<vertex::Vertex> vertices;
+
+    if (lua_isnumber(L, start))
+    {
+        int count = (int)luaL_checkinteger(L, start);
+
+        if (count <= 0)
+            return luaL_error(L, "Invalid number of vertices (%d).", count);
+
+        vertex::Vertex empty = { .position = { 0.0f, 0.0f },
+                                 .color    = { 0xFF, 0xFF, 0xFF, 0xFF },
+                                 .texcoord = { 0, 0 } };
+
+        vertices.resize(count, empty);
+    }
+    else
+    {
+        luaL_checktype(L, start, LUA_TTABLE);
+        size_t count = lua_objlen(L, start);
+
+        vertices.reserve(count);
+
+        for (size_t index = 1; index <= count; index++)
+        {
+            lua_rawgeti(L, start, index);
+            vertices.push_back(Wrap_Mesh::CheckVertex(L, -1, format));
+            lua_pop(L, 1);
+        }
+    }
+
+    Mesh::DrawMode mode = Mesh::DRAWMODE_FAN;
+
+    if (!lua_isnoneornil(L, start + 1))
+    {
+        const char* modeStr = luaL_checkstring(L, start + 1);
+
+        if (!Mesh::GetConstant(modeStr, mode))
+            return Luax::EnumError(L, "mesh draw mode", Mesh::GetConstants(mode), modeStr);
+    }
+
+    vertex::Usage usage = vertex::USAGE_DYNAMIC;
+
+    if (!lua_isnoneornil(L, start + 2))
+    {
+        const char* usageStr = luaL_checkstring(L, start + 2);
+
+        if (!vertex::GetConstant(usageStr, usage))
+            return Luax::EnumError(L, "usage hint", vertex::GetConstants(usage), usageStr);
+    }
+
+    Mesh* mesh = nullptr;
+
+    Luax::CatchException(
+        L, [&]() { mesh = instance()->NewMesh(format, vertices, mode, usage); });
+
+    Luax::PushType(L, mesh);
+    mesh->Release();
+
+    return 1;
+}
+
+int Wrap_Graphics::NewInstanceBuffer(lua_State* L)
+{
+    int size = (int)luaL_checkinteger(L, 1);
+
+    if (size <= 0)
+        return luaL_error(L, "Invalid number of instances (%d).", size);
+
+    vertex::Usage usage = vertex::USAGE_DYNAMIC;
+
+    if (!lua_isnoneornil(L, 2))
+    {
+        const char* usageStr = luaL_checkstring(L, 2);
+
+        if (!vertex::GetConstant(usageStr, usage))
+            return Luax::EnumError(L, "usage hint", vertex::GetConstants(usage), usageStr);
+    }
+
+    InstanceBuffer* buffer = nullptr;
+
+    Luax::CatchException(L, [&]() { buffer = instance()->NewInstanceBuffer(size, usage); });
+
+    Luax::PushType(L, buffer);
+    buffer->Release();
+
+    return 1;
+}
+#endif
+
 int Wrap_Graphics::NewCanvas(lua_State* L)
 {
     Canvas::Settings settings;
@@ -1054,6 +1208,35 @@ int Wrap_Graphics::Draw(lua_State* L)
     return 0;
 }
 
+#if defined(__SWITCH__)
+/* drawInstanced(mesh | texture, count, instances, x, y, r, sx, sy, ox, oy, kx, ky) */
+int Wrap_Graphics::DrawInstanced(lua_State* L)
+{
+    Mesh* mesh       = nullptr;
+    Texture* texture = nullptr;
+
+    if (Luax::IsType(L, 1, Mesh::type))
+        mesh = Wrap_Mesh::CheckMesh(L, 1);
+    else
+        texture = Wrap_Texture::CheckTexture(L, 1);
+
+    int count = (int)luaL_checkinteger(L, 2);
+
+    InstanceBuffer* instances = Wrap_InstanceBuffer::CheckInstanceBuffer(L, 3);
+
+    Graphics::CheckStandardTransform(L, 4, [&](const Matrix4& m) {
+        Luax::CatchException(L, [&]() {
+            if (mesh)
+                instance()->DrawInstanced(mesh, instances, count, m);
+            else
+                instance()->DrawInstanced(texture, instances, count, m);
+        });
+    });
+
+    return 0;
+}
+#endif
+
 int Wrap_Graphics::Print(lua_State* L)
 {
     std::vector<Font::ColoredString> string;
@@ -1394,6 +1577,52 @@ int Wrap_Graphics::GetWide(lua_State* L)
     return 0;
 }
 
+int Wrap_Graphics::SetStereoRecording(lua_State* L)
+{
+#if defined(__3DS__)
+    bool enabled = Luax::ToBoolean(L, 1);
+
+    auto instance = (love::citro2d::Graphics*)instance();
+    instance->SetStereoRecording(enabled);
+#endif
+    return 0;
+}
+
+int Wrap_Graphics::GetStereoRecording(lua_State* L)
+{
+#if defined(__3DS__)
+    auto instance = (love::citro2d::Graphics*)instance();
+
+    Luax::PushBoolean(L, instance->GetStereoRecording());
+
+    return 1;
+#endif
+    return 0;
+}
+
+int Wrap_Graphics::SetStereoDepth(lua_State* L)
+{
+#if defined(__3DS__)
+    float depth = luaL_checknumber(L, 1);
+
+    auto instance = (love::citro2d::Graphics*)instance();
+    instance->SetStereoDepth(depth);
+#endif
+    return 0;
+}
+
+int Wrap_Graphics::GetStereoDepth(lua_State* L)
+{
+#if defined(__3DS__)
+    auto instance = (love::citro2d::Graphics*)instance();
+
+    lua_pushnumber(L, instance->GetStereoDepth());
+
+    return 1;
+#endif
+    return 0;
+}
+
 /* End Nintendo 3DS */
 
 int Wrap_Graphics::GetRendererInfo(lua_State* L)
@@ -1408,6 +1637,83 @@ int Wrap_Graphics::GetRendererInfo(lua_State* L)
     return 4;
 }
 
+int Wrap_Graphics::GetStats(lua_State* L)
+{
+    Graphics::Stats stats = instance()->GetStats();
+
+    if (lua_istable(L, 1))
+        lua_pushvalue(L, 1);
+    else
+        lua_createtable(L, 0, 19);
+
+    lua_pushinteger(L, stats.drawCalls);
+    lua_setfield(L, -2, "drawcalls");
+
+    lua_pushinteger(L, stats.drawCallsBatched);
+    lua_setfield(L, -2, "drawcallsbatched");
+
+    lua_pushinteger(L, stats.canvasSwitches);
+    lua_setfield(L, -2, "canvasswitches");
+
+    lua_pushinteger(L, stats.shaderSwitches);
+    lua_setfield(L, -2, "shaderswitches");
+
+    lua_pushinteger(L, stats.textureBinds);
+    lua_setfield(L, -2, "texturebinds");
+
+    lua_pushinteger(L, stats.vertices);
+    lua_setfield(L, -2, "vertices");
+
+    lua_pushinteger(L, stats.skippedBinds);
+    lua_setfield(L, -2, "skippedbinds");
+
+    lua_pushinteger(L, stats.flushes);
+    lua_setfield(L, -2, "flushes");
+
+    lua_pushinteger(L, stats.canvases);
+    lua_setfield(L, -2, "canvases");
+
+    lua_pushinteger(L, stats.images);
+    lua_setfield(L, -2, "images");
+
+    lua_pushinteger(L, stats.fonts);
+    lua_setfield(L, -2, "fonts");
+
+    lua_pushinteger(L, stats.descriptors);
+    lua_setfield(L, -2, "descriptors");
+
+    lua_pushinteger(L, stats.evictions);
+    lua_setfield(L, -2, "evictions");
+
+    lua_pushinteger(L, stats.restores);
+    lua_setfield(L, -2, "restores");
+
+    lua_pushnumber(L, (lua_Number)stats.textureMemory);
+    lua_setfield(L, -2, "texturememory");
+
+    lua_pushnumber(L, (lua_Number)stats.evictedMemory);
+    lua_setfield(L, -2, "evictedmemory");
+
+    lua_pushnumber(L, (lua_Number)stats.vertexHighWater);
+    lua_setfield(L, -2, "vertexhighwater");
+
+    lua_pushnumber(L, (lua_Number)stats.commandHighWater);
+    lua_setfield(L, -2, "commandhighwater");
+
+    /* bytes in use for each of the renderer's memory pools */
+    lua_createtable(L, 0, stats.pools.size());
+
+    for (const auto& pool : stats.pools)
+    {
+        lua_pushnumber(L, (lua_Number)pool.second);
+        lua_setfield(L, -2, pool.first);
+    }
+
+    lua_setfield(L, -2, "pools");
+
+    return 1;
+}
+
 // clang-format off
 static constexpr luaL_Reg functions[] =
 {
@@ -1416,6 +1722,9 @@ static constexpr luaL_Reg functions[] =
     { "circle",                Wrap_Graphics::Circle                },
     { "clear",                 Wrap_Graphics::Clear                 },
     { "draw",                  Wrap_Graphics::Draw                  },
+#if defined(__SWITCH__)
+    { "drawInstanced",         Wrap_Graphics::DrawInstanced         },
+#endif
     { "ellipse",               Wrap_Graphics::Ellipse               },
     { "getActiveScreen",       Wrap_Graphics::GetActiveScreen       },
     { "getBackgroundColor",    Wrap_Graphics::GetBackgroundColor    },
@@ -1434,6 +1743,7 @@ static constexpr luaL_Reg functions[] =
     { "getRendererInfo",       Wrap_Graphics::GetRendererInfo       },
     { "getScissor",            Wrap_Graphics::GetScissor            },
     { "getScreens",            Wrap_Graphics::GetScreens            },
+    { "getStats",              Wrap_Graphics::GetStats              },
     { "getWidth",              Wrap_Graphics::GetWidth              },
     { "intersectScissor",      Wrap_Graphics::IntersectScissor      },
     { "inverseTransformPoint", Wrap_Graphics::InverseTransformPoint },
@@ -1443,7 +1753,13 @@ static constexpr luaL_Reg functions[] =
     { "newCanvas",             Wrap_Graphics::NewCanvas             },
     { "newFont",               Wrap_Graphics::NewFont               },
     { "newImage",              Wrap_Graphics::NewImage              },
+#if defined(__SWITCH__)
+    { "newInstanceBuffer",     Wrap_Graphics::NewInstanceBuffer     },
+    { "newMesh",               Wrap_Graphics::NewMesh               },
+#endif
+    { "newParticleSystem",     Wrap_Graphics::NewParticleSystem     },
     { "newQuad",               Wrap_Graphics::NewQuad               },
+    { "newSpriteBatch",        Wrap_Graphics::NewSpriteBatch        },
     { "newText",               Wrap_Graphics::NewText               },
     { "_newVideo",             Wrap_Graphics::NewVideo              },
     { "origin",                Wrap_Graphics::Origin                },
@@ -1482,6 +1798,10 @@ static constexpr luaL_Reg functions[] =
     { "set3D",                 Wrap_Graphics::Set3D                 },
     { "getWide",               Wrap_Graphics::GetWide               },
     { "setWide",               Wrap_Graphics::SetWide               },
+    { "getStereoDepth",        Wrap_Graphics::GetStereoDepth        },
+    { "setStereoDepth",        Wrap_Graphics::SetStereoDepth        },
+    { "getStereoRecording",    Wrap_Graphics::GetStereoRecording    },
+    { "setStereoRecording",    Wrap_Graphics::SetStereoRecording    },
 #endif
     { 0,                       0                                    }
 };
@@ -1495,8 +1815,12 @@ static constexpr lua_CFunction types[] =
     Wrap_Image::Register,
     Wrap_Quad::Register,
 #if defined(__SWITCH__)
+    Wrap_InstanceBuffer::Register,
+    Wrap_Mesh::Register,
     Wrap_Shader::Register,
 #endif
+    Wrap_ParticleSystem::Register,
+    Wrap_SpriteBatch::Register,
     Wrap_Text::Register,
     Wrap_Video::Register,
     nullptr
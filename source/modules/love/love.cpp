@@ -25,6 +25,10 @@
 #include "https/common/HTTPSCommon.h"
 #include "luasocket/luasocket.h"
 
+#if defined(__SWITCH__)
+    #include "deko3d/deko.h"
+#endif
+
 /* included scripts */
 #include "nogame_lua.h"
 
@@ -129,6 +133,14 @@ int love::Initialize(lua_State* L)
     lua_pushcfunction(L, EnableAccelerometerAsJoystick);
     lua_setfield(L, -2, "_setAccelerometerAsJoystick");
 
+#if defined(__SWITCH__)
+    lua_pushcfunction(L, SetVertexBufferSize);
+    lua_setfield(L, -2, "_setVertexBufferSize");
+
+    lua_pushcfunction(L, SetBufferCount);
+    lua_setfield(L, -2, "_setBufferCount");
+#endif
+
     lua_pushcfunction(L, IsVersionCompatible);
     lua_setfield(L, -2, "isVersionCompatible");
 
@@ -160,6 +172,28 @@ int love::EnableAccelerometerAsJoystick(lua_State* L)
     return 0;
 }
 
+#if defined(__SWITCH__)
+int love::SetVertexBufferSize(lua_State* L)
+{
+    lua_Integer size = luaL_checkinteger(L, 1);
+    luaL_argcheck(L, size > 0, 1, "vertex buffer size must be positive");
+
+    ::deko3d::SetVertexBufferSize(size);
+
+    return 0;
+}
+
+int love::SetBufferCount(lua_State* L)
+{
+    lua_Integer count = luaL_checkinteger(L, 1);
+    luaL_argcheck(L, count == 2 || count == 3, 1, "buffer count must be 2 or 3");
+
+    ::deko3d::SetRingSliceCount(count);
+
+    return 0;
+}
+#endif
+
 int love::LoadArgs(lua_State* L)
 {
     if (luaL_loadbuffer(L, arg_lua, sizeof(arg_lua), "=[love \"arg.lua\"]") == 0)
@@ -188,6 +188,12 @@ function love.init()
             mixwithsystem = true,
             mic = false,
         },
+        graphics = {
+            -- bytes of vertices per frame before extra buffers get chained on
+            vertexbuffersize = 512 * 1024,
+            -- frames the CPU may record ahead of the GPU: 2 or 3
+            buffercount = 2,
+        },
         console = false,
         identity = false,
         appendidentity = false,
@@ -240,6 +246,18 @@ function love.init()
         love._setGammaCorrect(config.gammacorrect)
     end
 
+    if love._setVertexBufferSize then
+        if config.graphics and config.graphics.vertexbuffersize then
+            love._setVertexBufferSize(config.graphics.vertexbuffersize)
+        end
+    end
+
+    if love._setBufferCount then
+        if config.graphics and config.graphics.buffercount then
+            love._setBufferCount(config.graphics.buffercount)
+        end
+    end
+
     if love._setAudioMixWithSystem then
         if config.audio and config.audio.mixwithsystem ~= nil then
             love._setAudioMixWithSystem(config.audio.mixwithsystem)
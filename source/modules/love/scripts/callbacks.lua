@@ -243,6 +243,11 @@ local function is3DHack()
     return true
 end
 
+-- when recording, the right eye is replayed from what was drawn to the left
+local function isReplayedEye(screen)
+    return screen == "right" and love.graphics.getStereoRecording()
+end
+
 function love.run()
     if love.load then
         love.load(arg)
@@ -291,13 +296,15 @@ function love.run()
             local screens = is3DHack() and normalScreens or plainScreens
 
             for _, screen in ipairs(screens) do
-                love.graphics.origin()
+                if not isReplayedEye(screen) then
+                    love.graphics.origin()
 
-                love.graphics.setActiveScreen(screen)
-                love.graphics.clear(love.graphics.getBackgroundColor())
+                    love.graphics.setActiveScreen(screen)
+                    love.graphics.clear(love.graphics.getBackgroundColor())
 
-                if love.draw then
-                    love.draw(screen)
+                    if love.draw then
+                        love.draw(screen)
+                    end
                 end
             end
 
@@ -3,8 +3,8 @@
 #include "common/vector.h"
 #include "objects/transform/transform.h"
 
+#include <algorithm>
 #include <cmath>
-#include <list>
 
 using namespace love;
 
@@ -36,12 +36,42 @@ std::vector<Math::Triangle> Math::Triangulate(const std::vector<Vector2>& polygo
 {
     if (polygon.size() < 3)
         throw love::Exception("Not a polygon");
-    else if (polygon.size() == 3)
-        return std::vector<Triangle>(1, Triangle(polygon[0], polygon[1], polygon[2]));
+
+    std::vector<uint32_t> indices;
+
+    if (!Math::Triangulate(polygon, indices))
+        throw love::Exception("Cannot triangulate polygon.");
+
+    std::vector<Triangle> triangles;
+    triangles.reserve(indices.size() / 3);
+
+    for (size_t i = 0; i < indices.size(); i += 3)
+    {
+        triangles.push_back(
+            Triangle(polygon[indices[i]], polygon[indices[i + 1]], polygon[indices[i + 2]]));
+    }
+
+    return triangles;
+}
+
+bool Math::Triangulate(std::span<const Vector2> polygon, std::vector<uint32_t>& triangles)
+{
+    triangles.clear();
+
+    if (polygon.size() < 3)
+        return false;
+
+    triangles.reserve((polygon.size() - 2) * 3);
+
+    if (polygon.size() == 3)
+    {
+        triangles.insert(triangles.end(), { 0, 1, 2 });
+        return true;
+    }
 
     // collect list of connections and record leftmost item to check if the polygon
     // has the expected winding
-    std::vector<size_t> next_idx(polygon.size()), prev_idx(polygon.size());
+    std::vector<uint32_t> next_idx(polygon.size()), prev_idx(polygon.size());
     size_t idx_lm = 0;
 
     for (size_t i = 0; i < polygon.size(); ++i)
@@ -60,40 +90,48 @@ std::vector<Math::Triangle> Math::Triangulate(const std::vector<Vector2>& polygo
     prev_idx[0]                   = prev_idx.size() - 1;
 
     // check if the polygon has the expected winding and reverse polygon if needed
-    if (!this->IsCounterClockwise(polygon[prev_idx[idx_lm]], polygon[idx_lm],
-                                  polygon[next_idx[idx_lm]]))
+    if (!IsCounterClockwise(polygon[prev_idx[idx_lm]], polygon[idx_lm],
+                            polygon[next_idx[idx_lm]]))
         next_idx.swap(prev_idx);
 
-    // collect list of concave polygons
-    std::list<const love::Vector2*> concave_vertices;
+    // collect list of concave vertices, the only ones that can be inside an ear
+    std::vector<uint32_t> concave_vertices;
 
     for (size_t i = 0; i < polygon.size(); ++i)
     {
-        if (!this->IsCounterClockwise(polygon[prev_idx[i]], polygon[i], polygon[next_idx[i]]))
-            concave_vertices.push_back(&polygon[i]);
+        if (!IsCounterClockwise(polygon[prev_idx[i]], polygon[i], polygon[next_idx[i]]))
+            concave_vertices.push_back(i);
     }
 
     // triangulation according to kong
-    std::vector<Triangle> triangles;
     size_t n_vertices = polygon.size();
-    size_t current = 1, skipped = 0, next, prev;
+    size_t skipped    = 0;
+    uint32_t current = 1, next, prev;
 
     while (n_vertices > 3)
     {
-        next             = next_idx[current];
-        prev             = prev_idx[current];
-        const Vector2 &a = polygon[prev], &b = polygon[current], &c = polygon[next];
-        if (this->IsEar(a, b, c, concave_vertices))
+        next = next_idx[current];
+        prev = prev_idx[current];
+
+        if (IsEar(polygon, prev, current, next, concave_vertices))
         {
-            triangles.push_back(Triangle(a, b, c));
+            triangles.insert(triangles.end(), { prev, current, next });
             next_idx[prev] = next;
             prev_idx[next] = prev;
-            concave_vertices.remove(&b);
+
+            auto clipped = std::find(concave_vertices.begin(), concave_vertices.end(), current);
+
+            if (clipped != concave_vertices.end())
+            {
+                *clipped = concave_vertices.back();
+                concave_vertices.pop_back();
+            }
+
             --n_vertices;
             skipped = 0;
         }
         else if (++skipped > n_vertices)
-            throw love::Exception("Cannot triangulate polygon.");
+            return false;
 
         current = next;
     }
@@ -101,12 +139,12 @@ std::vector<Math::Triangle> Math::Triangulate(const std::vector<Vector2>& polygo
     next = next_idx[current];
     prev = prev_idx[current];
 
-    triangles.push_back(Triangle(polygon[prev], polygon[current], polygon[next]));
+    triangles.insert(triangles.end(), { prev, current, next });
 
-    return triangles;
+    return true;
 }
 
-bool Math::IsConvex(const std::vector<Vector2>& polygon)
+bool Math::IsConvex(std::span<const Vector2> polygon)
 {
     if (polygon.size() < 3)
         return false;
@@ -4,10 +4,19 @@ using namespace love::common;
 
 love::Type Canvas::type("Canvas", &Texture::type);
 
+int Canvas::canvasCount = 0;
+
 Canvas::Canvas(const Settings& settings) : Texture(TEXTURE_2D), settings(settings)
 {
     this->width  = settings.width;
     this->height = settings.height;
 
     this->InitQuad();
+
+    canvasCount++;
+}
+
+Canvas::~Canvas()
+{
+    --canvasCount;
 }
\ No newline at end of file
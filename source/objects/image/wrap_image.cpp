@@ -4,12 +4,29 @@ using namespace love;
 
 love::Type Image::type("Image", &Texture::type);
 
+int Wrap_Image::GenerateMipmaps(lua_State* L)
+{
+    Image* self = Wrap_Image::CheckImage(L, 1);
+
+    Luax::CatchException(L, [&]() { self->GenerateMipmaps(); });
+
+    return 0;
+}
+
 Image* Wrap_Image::CheckImage(lua_State* L, int index)
 {
     return Luax::CheckType<Image>(L, index);
 }
 
+// clang-format off
+static constexpr luaL_Reg functions[] =
+{
+    { "generateMipmaps", Wrap_Image::GenerateMipmaps },
+    { 0,                 0                           }
+};
+// clang-format on
+
 int Wrap_Image::Register(lua_State* L)
 {
-    return Luax::RegisterType(L, &Image::type, Wrap_Texture::functions, nullptr);
+    return Luax::RegisterType(L, &Image::type, Wrap_Texture::functions, functions, nullptr);
 }
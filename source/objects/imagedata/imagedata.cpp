@@ -8,6 +8,10 @@
 
 #include <algorithm>
 
+#if defined(__3DS__)
+    #include "common/tiling.h"
+#endif
+
 using namespace love;
 using thread::Lock;
 
@@ -434,22 +438,13 @@ void ImageData::Paste(ImageData* src, int dx, int dy, int sx, int sy, int sw, in
     unsigned _srcPowTwo = NextPO2(src->width);
     unsigned _dstPowTwo = NextPO2(this->width);
 
-    for (int y = 0; y < std::min(sh, dstH - dy); y++)
-    {
-        for (int x = 0; x < std::min(sw, dstW - dx); x++)
-        {
-            unsigned srcIndex = coordToIndex(_srcPowTwo, (sx + x), (sy + y));
-            unsigned dstIndex = coordToIndex(_dstPowTwo, (dx + x), (dy + y));
+    int copyWidth  = std::min(sw, dstW - dx);
+    int copyHeight = std::min(sh, dstH - dy);
 
-            Colorf color {};
-
-            const Pixel* srcPixel = reinterpret_cast<const Pixel*>((uint32_t*)src->data + srcIndex);
-            getPixelRGBA8(srcPixel, color);
-
-            Pixel* dstPixel = reinterpret_cast<Pixel*>((uint32_t*)this->data + dstIndex);
-            setPixelRGBA8(color, dstPixel);
-        }
-    }
+    /* both sides are RGBA8, so the texels move as they are */
+    if (copyWidth > 0 && copyHeight > 0)
+        tiling::CopyTiled((const uint32_t*)src->data, _srcPowTwo, sx, sy, (uint32_t*)this->data,
+                          _dstPowTwo, dx, dy, copyWidth, copyHeight);
 #elif defined(__SWITCH__)
     uint8_t* source = (uint8_t*)src->GetData();
     uint8_t* destination = (uint8_t*)this->GetData();
@@ -0,0 +1,706 @@
+#include "objects/particlesystem/particlesystemc.h"
+
+#include "common/bidirectionalmap.h"
+#include "common/exception.h"
+#include "modules/math/mathmodule.h"
+
+#include <algorithm>
+
+love::Type love::common::ParticleSystem::type("ParticleSystem", &Drawable::type);
+
+using namespace love::common;
+
+namespace
+{
+    float CalculateVariation(float inner, float outer, float variation, love::RandomGenerator& rng)
+    {
+        float low  = inner - (outer / 2.0f) * variation;
+        float high = inner + (outer / 2.0f) * variation;
+        float r    = (float)rng.Random();
+
+        return low * (1.0f - r) + high * r;
+    }
+} // namespace
+
+ParticleSystem::ParticleSystem(love::Texture* texture, uint32_t size) :
+    texture(texture),
+    maxParticles(0),
+    activeCount(0),
+    active(true),
+    paused(false),
+    emissionRate(0.0f),
+    emitCounter(0.0f),
+    emissionAreaDistribution(DISTRIBUTION_NONE),
+    emissionAreaAngle(0.0f),
+    directionRelativeToEmissionCenter(false),
+    lifetime(-1.0f),
+    life(0.0f),
+    particleLifeMin(0.0f),
+    particleLifeMax(0.0f),
+    direction(0.0f),
+    spread(0.0f),
+    speedMin(0.0f),
+    speedMax(0.0f),
+    radialAccelerationMin(0.0f),
+    radialAccelerationMax(0.0f),
+    tangentialAccelerationMin(0.0f),
+    tangentialAccelerationMax(0.0f),
+    linearDampingMin(0.0f),
+    linearDampingMax(0.0f),
+    sizes { 1.0f },
+    sizeVariation(0.0f),
+    rotationMin(0.0f),
+    rotationMax(0.0f),
+    spinStart(0.0f),
+    spinEnd(0.0f),
+    spinVariation(0.0f),
+    offset((float)texture->GetWidth() * 0.5f, (float)texture->GetHeight() * 0.5f),
+    colors { Colorf(1.0f, 1.0f, 1.0f, 1.0f) },
+    relativeRotation(false)
+{
+    if (size == 0 || size > MAX_PARTICLES)
+        throw love::Exception("Invalid ParticleSystem size.");
+
+    /* don't make every system spawn the exact same particles */
+    auto math = Module::GetInstance<Math>(Module::M_MATH);
+
+    if (math != nullptr)
+    {
+        RandomGenerator::Seed seed;
+        seed.b64 = math->GetRandomGenerator()->UniformRandom();
+
+        this->rng.SetSeed(seed);
+    }
+
+    this->SetBufferSize(size);
+}
+
+ParticleSystem::~ParticleSystem()
+{}
+
+ParticleSystem::Channels ParticleSystem::GetChannels()
+{
+    auto& p = this->particles;
+
+    // clang-format off
+    return {
+        &p.x,          &p.y,
+        &p.originX,    &p.originY,
+        &p.velocityX,  &p.velocityY,
+        &p.accelerationX, &p.accelerationY,
+        &p.radial,     &p.tangential,
+        &p.damping,
+        &p.life,       &p.lifetime,
+        &p.rotation,   &p.angle,
+        &p.spinStart,  &p.spinEnd,
+        &p.sizeOffset, &p.sizeInterval,
+        &p.size,
+        &p.r, &p.g, &p.b, &p.a
+    };
+    // clang-format on
+}
+
+void ParticleSystem::SetTexture(love::Texture* texture)
+{
+    this->texture.Set(texture);
+}
+
+love::Texture* ParticleSystem::GetTexture() const
+{
+    return this->texture.Get();
+}
+
+void ParticleSystem::SetBufferSize(uint32_t size)
+{
+    if (size == 0 || size > MAX_PARTICLES)
+        throw love::Exception("Invalid buffer size");
+
+    for (auto* channel : this->GetChannels())
+        channel->resize(size);
+
+    this->maxParticles = size;
+    this->activeCount  = std::min(this->activeCount, size);
+}
+
+uint32_t ParticleSystem::GetBufferSize() const
+{
+    return this->maxParticles;
+}
+
+void ParticleSystem::SetEmissionRate(float rate)
+{
+    if (rate < 0.0f)
+        throw love::Exception("Invalid emission rate");
+
+    this->emissionRate = rate;
+
+    /* prevent an explosion when dramatically increasing the rate */
+    this->emitCounter = std::min(this->emitCounter, 1.0f / rate);
+}
+
+float ParticleSystem::GetEmissionRate() const
+{
+    return this->emissionRate;
+}
+
+void ParticleSystem::SetEmitterLifetime(float lifetime)
+{
+    this->life = this->lifetime = lifetime;
+}
+
+float ParticleSystem::GetEmitterLifetime() const
+{
+    return this->lifetime;
+}
+
+void ParticleSystem::SetParticleLifetime(float min, float max)
+{
+    this->particleLifeMin = min;
+    this->particleLifeMax = max;
+}
+
+void ParticleSystem::GetParticleLifetime(float& min, float& max) const
+{
+    min = this->particleLifeMin;
+    max = this->particleLifeMax;
+}
+
+void ParticleSystem::SetPosition(float x, float y)
+{
+    this->position     = Vector2(x, y);
+    this->prevPosition = this->position;
+}
+
+const love::Vector2& ParticleSystem::GetPosition() const
+{
+    return this->position;
+}
+
+void ParticleSystem::MoveTo(float x, float y)
+{
+    this->position = Vector2(x, y);
+}
+
+void ParticleSystem::SetEmissionArea(AreaSpreadDistribution distribution, float x, float y,
+                                     float angle, bool directionRelativeToCenter)
+{
+    this->emissionAreaDistribution          = distribution;
+    this->emissionArea                      = Vector2(x, y);
+    this->emissionAreaAngle                 = angle;
+    this->directionRelativeToEmissionCenter = directionRelativeToCenter;
+}
+
+ParticleSystem::AreaSpreadDistribution ParticleSystem::GetEmissionArea(
+    Vector2& params, float& angle, bool& directionRelativeToCenter) const
+{
+    params                    = this->emissionArea;
+    angle                     = this->emissionAreaAngle;
+    directionRelativeToCenter = this->directionRelativeToEmissionCenter;
+
+    return this->emissionAreaDistribution;
+}
+
+void ParticleSystem::SetDirection(float direction)
+{
+    this->direction = direction;
+}
+
+float ParticleSystem::GetDirection() const
+{
+    return this->direction;
+}
+
+void ParticleSystem::SetSpread(float spread)
+{
+    this->spread = spread;
+}
+
+float ParticleSystem::GetSpread() const
+{
+    return this->spread;
+}
+
+void ParticleSystem::SetSpeed(float min, float max)
+{
+    this->speedMin = min;
+    this->speedMax = max;
+}
+
+void ParticleSystem::GetSpeed(float& min, float& max) const
+{
+    min = this->speedMin;
+    max = this->speedMax;
+}
+
+void ParticleSystem::SetLinearAcceleration(float xmin, float ymin, float xmax, float ymax)
+{
+    this->linearAccelerationMin = Vector2(xmin, ymin);
+    this->linearAccelerationMax = Vector2(xmax, ymax);
+}
+
+void ParticleSystem::GetLinearAcceleration(Vector2& min, Vector2& max) const
+{
+    min = this->linearAccelerationMin;
+    max = this->linearAccelerationMax;
+}
+
+void ParticleSystem::SetRadialAcceleration(float min, float max)
+{
+    this->radialAccelerationMin = min;
+    this->radialAccelerationMax = max;
+}
+
+void ParticleSystem::GetRadialAcceleration(float& min, float& max) const
+{
+    min = this->radialAccelerationMin;
+    max = this->radialAccelerationMax;
+}
+
+void ParticleSystem::SetTangentialAcceleration(float min, float max)
+{
+    this->tangentialAccelerationMin = min;
+    this->tangentialAccelerationMax = max;
+}
+
+void ParticleSystem::GetTangentialAcceleration(float& min, float& max) const
+{
+    min = this->tangentialAccelerationMin;
+    max = this->tangentialAccelerationMax;
+}
+
+void ParticleSystem::SetLinearDamping(float min, float max)
+{
+    this->linearDampingMin = min;
+    this->linearDampingMax = max;
+}
+
+void ParticleSystem::GetLinearDamping(float& min, float& max) const
+{
+    min = this->linearDampingMin;
+    max = this->linearDampingMax;
+}
+
+void ParticleSystem::SetSizes(const std::vector<float>& sizes)
+{
+    if (sizes.empty() || sizes.size() > MAX_SIZES)
+        throw love::Exception("At most %zu sizes may be used.", MAX_SIZES);
+
+    this->sizes = sizes;
+}
+
+const std::vector<float>& ParticleSystem::GetSizes() const
+{
+    return this->sizes;
+}
+
+void ParticleSystem::SetSizeVariation(float variation)
+{
+    this->sizeVariation = variation;
+}
+
+float ParticleSystem::GetSizeVariation() const
+{
+    return this->sizeVariation;
+}
+
+void ParticleSystem::SetRotation(float min, float max)
+{
+    this->rotationMin = min;
+    this->rotationMax = max;
+}
+
+void ParticleSystem::GetRotation(float& min, float& max) const
+{
+    min = this->rotationMin;
+    max = this->rotationMax;
+}
+
+void ParticleSystem::SetSpin(float start, float end)
+{
+    this->spinStart = start;
+    this->spinEnd   = end;
+}
+
+void ParticleSystem::GetSpin(float& start, float& end) const
+{
+    start = this->spinStart;
+    end   = this->spinEnd;
+}
+
+void ParticleSystem::SetSpinVariation(float variation)
+{
+    this->spinVariation = variation;
+}
+
+float ParticleSystem::GetSpinVariation() const
+{
+    return this->spinVariation;
+}
+
+void ParticleSystem::SetOffset(float x, float y)
+{
+    this->offset = Vector2(x, y);
+}
+
+const love::Vector2& ParticleSystem::GetOffset() const
+{
+    return this->offset;
+}
+
+void ParticleSystem::SetColors(const std::vector<Colorf>& colors)
+{
+    if (colors.empty() || colors.size() > MAX_COLORS)
+        throw love::Exception("At most %zu colors may be used.", MAX_COLORS);
+
+    this->colors = colors;
+}
+
+const std::vector<Colorf>& ParticleSystem::GetColors() const
+{
+    return this->colors;
+}
+
+void ParticleSystem::SetRelativeRotation(bool enable)
+{
+    this->relativeRotation = enable;
+}
+
+bool ParticleSystem::HasRelativeRotation() const
+{
+    return this->relativeRotation;
+}
+
+uint32_t ParticleSystem::GetCount() const
+{
+    return this->activeCount;
+}
+
+void ParticleSystem::Start()
+{
+    this->active = true;
+}
+
+void ParticleSystem::Stop()
+{
+    this->active      = false;
+    this->life        = this->lifetime;
+    this->emitCounter = 0.0f;
+}
+
+void ParticleSystem::Pause()
+{
+    this->active = false;
+    this->paused = true;
+}
+
+void ParticleSystem::Reset()
+{
+    this->activeCount = 0;
+    this->life        = this->lifetime;
+    this->emitCounter = 0.0f;
+}
+
+void ParticleSystem::Emit(uint32_t count)
+{
+    if (!this->active)
+        return;
+
+    count = std::min(count, this->maxParticles - this->activeCount);
+
+    for (uint32_t index = 0; index < count; index++)
+        this->AddParticle(1.0f);
+}
+
+bool ParticleSystem::IsActive() const
+{
+    return this->active;
+}
+
+bool ParticleSystem::IsPaused() const
+{
+    return this->paused;
+}
+
+bool ParticleSystem::IsStopped() const
+{
+    return !this->active && !this->paused;
+}
+
+bool ParticleSystem::IsEmpty() const
+{
+    return this->activeCount == 0;
+}
+
+bool ParticleSystem::IsFull() const
+{
+    return this->activeCount == this->maxParticles;
+}
+
+void ParticleSystem::AddParticle(float t)
+{
+    if (this->IsFull())
+        return;
+
+    auto& p              = this->particles;
+    uint32_t index       = this->activeCount++;
+    RandomGenerator& rng = this->rng;
+
+    float min = this->particleLifeMin;
+    float max = this->particleLifeMax;
+
+    p.lifetime[index] = (min == max) ? min : (float)rng.Random(min, max);
+    p.life[index]     = p.lifetime[index];
+
+    float x = this->prevPosition.x + (this->position.x - this->prevPosition.x) * t;
+    float y = this->prevPosition.y + (this->position.y - this->prevPosition.y) * t;
+
+    float spread    = this->spread / 2.0f;
+    float direction = this->direction + (float)rng.Random(-spread, spread);
+
+    if (this->emissionAreaDistribution != DISTRIBUTION_NONE)
+    {
+        float areaX = 0.0f;
+        float areaY = 0.0f;
+
+        if (this->emissionAreaDistribution == DISTRIBUTION_UNIFORM)
+        {
+            areaX = (float)rng.Random(-this->emissionArea.x, this->emissionArea.x);
+            areaY = (float)rng.Random(-this->emissionArea.y, this->emissionArea.y);
+        }
+        else
+        {
+            areaX = (float)rng.RandomNormal(this->emissionArea.x);
+            areaY = (float)rng.RandomNormal(this->emissionArea.y);
+        }
+
+        float c = cosf(this->emissionAreaAngle);
+        float s = sinf(this->emissionAreaAngle);
+
+        float offsetX = areaX * c - areaY * s;
+        float offsetY = areaX * s + areaY * c;
+
+        if (this->directionRelativeToEmissionCenter)
+            direction += atan2f(offsetY, offsetX);
+
+        x += offsetX;
+        y += offsetY;
+    }
+
+    p.x[index] = p.originX[index] = x;
+    p.y[index] = p.originY[index] = y;
+
+    float speed = (float)rng.Random(this->speedMin, this->speedMax);
+
+    p.velocityX[index] = cosf(direction) * speed;
+    p.velocityY[index] = sinf(direction) * speed;
+
+    p.accelerationX[index] =
+        (float)rng.Random(this->linearAccelerationMin.x, this->linearAccelerationMax.x);
+    p.accelerationY[index] =
+        (float)rng.Random(this->linearAccelerationMin.y, this->linearAccelerationMax.y);
+
+    p.radial[index] = (float)rng.Random(this->radialAccelerationMin, this->radialAccelerationMax);
+    p.tangential[index] =
+        (float)rng.Random(this->tangentialAccelerationMin, this->tangentialAccelerationMax);
+
+    p.damping[index] = (float)rng.Random(this->linearDampingMin, this->linearDampingMax);
+
+    p.sizeOffset[index]   = (float)rng.Random(this->sizeVariation);
+    p.sizeInterval[index] = (1.0f - (float)rng.Random(this->sizeVariation)) - p.sizeOffset[index];
+    p.size[index]         = this->sizes[(size_t)(p.sizeOffset[index] * (this->sizes.size() - 1))];
+
+    p.rotation[index] = (float)rng.Random(this->rotationMin, this->rotationMax);
+
+    p.spinStart[index] =
+        CalculateVariation(this->spinStart, this->spinEnd, this->spinVariation, rng);
+    p.spinEnd[index] = CalculateVariation(this->spinEnd, this->spinStart, this->spinVariation, rng);
+
+    p.angle[index] = p.rotation[index];
+
+    if (this->relativeRotation)
+        p.angle[index] += atan2f(p.velocityY[index], p.velocityX[index]);
+
+    p.r[index] = this->colors[0].r;
+    p.g[index] = this->colors[0].g;
+    p.b[index] = this->colors[0].b;
+    p.a[index] = this->colors[0].a;
+}
+
+/* Moves the last live particle into @index */
+void ParticleSystem::RemoveParticle(uint32_t index)
+{
+    uint32_t last = --this->activeCount;
+
+    if (index == last)
+        return;
+
+    for (auto* channel : this->GetChannels())
+        (*channel)[index] = (*channel)[last];
+}
+
+/*
+** Advance every live particle by @dt
+** Each pass walks a handful of arrays front to back
+** with no branches, so the compiler can vectorize them
+*/
+void ParticleSystem::Simulate(float dt)
+{
+    auto& p        = this->particles;
+    uint32_t count = this->activeCount;
+
+    float* x  = p.x.data();
+    float* y  = p.y.data();
+    float* vx = p.velocityX.data();
+    float* vy = p.velocityY.data();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        float radialX = x[i] - p.originX[i];
+        float radialY = y[i] - p.originY[i];
+
+        float length = sqrtf(radialX * radialX + radialY * radialY);
+        float scale  = (length > 0.0f) ? (1.0f / length) : 0.0f;
+
+        radialX *= scale;
+        radialY *= scale;
+
+        float accelerationX =
+            radialX * p.radial[i] - radialY * p.tangential[i] + p.accelerationX[i];
+        float accelerationY =
+            radialY * p.radial[i] + radialX * p.tangential[i] + p.accelerationY[i];
+
+        float damping = 1.0f / (1.0f + p.damping[i] * dt);
+
+        vx[i] = (vx[i] + accelerationX * dt) * damping;
+        vy[i] = (vy[i] + accelerationY * dt) * damping;
+
+        x[i] += vx[i] * dt;
+        y[i] += vy[i] * dt;
+    }
+
+    float* life     = p.life.data();
+    float* rotation = p.rotation.data();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        life[i] -= dt;
+
+        float t = std::clamp(1.0f - life[i] / p.lifetime[i], 0.0f, 1.0f);
+
+        rotation[i] += (p.spinStart[i] * (1.0f - t) + p.spinEnd[i] * t) * dt;
+        p.angle[i] = rotation[i];
+    }
+
+    if (this->relativeRotation)
+    {
+        for (uint32_t i = 0; i < count; i++)
+            p.angle[i] += atan2f(vy[i], vx[i]);
+    }
+
+    /*
+    ** Interpolate sizes and colors over each particle's lifetime
+    ** i = 0       1       2      3          n-1
+    **     |-------|-------|------|--- ... ---|
+    ** t = 0    1/(n-1)        3/(n-1)        1
+    */
+    size_t lastSize = this->sizes.size() - 1;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        float t = std::clamp(1.0f - life[i] / p.lifetime[i], 0.0f, 1.0f);
+        float s = (p.sizeOffset[i] + t * p.sizeInterval[i]) * (float)lastSize;
+
+        size_t k = std::min((size_t)s, lastSize);
+        size_t n = std::min(k + 1, lastSize);
+
+        s -= (float)k;
+
+        p.size[i] = this->sizes[k] * (1.0f - s) + this->sizes[n] * s;
+    }
+
+    size_t lastColor = this->colors.size() - 1;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        float t = std::clamp(1.0f - life[i] / p.lifetime[i], 0.0f, 1.0f);
+        float s = t * (float)lastColor;
+
+        size_t k = std::min((size_t)s, lastColor);
+        size_t n = std::min(k + 1, lastColor);
+
+        s -= (float)k;
+
+        const Colorf& from = this->colors[k];
+        const Colorf& to   = this->colors[n];
+
+        p.r[i] = from.r * (1.0f - s) + to.r * s;
+        p.g[i] = from.g * (1.0f - s) + to.g * s;
+        p.b[i] = from.b * (1.0f - s) + to.b * s;
+        p.a[i] = from.a * (1.0f - s) + to.a * s;
+    }
+
+    /* dead particles are swapped with the last live one */
+    for (uint32_t i = 0; i < this->activeCount;)
+    {
+        if (life[i] < 0.0f)
+            this->RemoveParticle(i);
+        else
+            i++;
+    }
+}
+
+void ParticleSystem::Update(float dt)
+{
+    if (this->paused || dt == 0.0f)
+        return;
+
+    this->Simulate(dt);
+
+    if (this->active)
+    {
+        if (this->emissionRate > 0.0f)
+        {
+            float rate = 1.0f / this->emissionRate;
+            this->emitCounter += dt;
+
+            float total = this->emitCounter - rate;
+
+            while (this->emitCounter > rate)
+            {
+                this->AddParticle((total > 0.0f) ? 1.0f - (this->emitCounter - rate) / total
+                                                 : 1.0f);
+                this->emitCounter -= rate;
+            }
+        }
+
+        this->life -= dt;
+
+        if (this->lifetime != -1.0f && this->life < 0.0f)
+            this->Stop();
+    }
+
+    this->prevPosition = this->position;
+}
+
+// clang-format off
+constexpr auto distributions = BidirectionalMap<>::Create(
+    "none",    ParticleSystem::AreaSpreadDistribution::DISTRIBUTION_NONE,
+    "uniform", ParticleSystem::AreaSpreadDistribution::DISTRIBUTION_UNIFORM,
+    "normal",  ParticleSystem::AreaSpreadDistribution::DISTRIBUTION_NORMAL
+);
+// clang-format on
+
+bool ParticleSystem::GetConstant(const char* in, AreaSpreadDistribution& out)
+{
+    return distributions.Find(in, out);
+}
+
+bool ParticleSystem::GetConstant(AreaSpreadDistribution in, const char*& out)
+{
+    return distributions.ReverseFind(in, out);
+}
+
+std::vector<const char*> ParticleSystem::GetConstants(AreaSpreadDistribution)
+{
+    return distributions.GetNames();
+}
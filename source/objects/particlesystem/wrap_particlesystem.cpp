@@ -0,0 +1,769 @@
+#include "objects/particlesystem/wrap_particlesystem.h"
+
+#include "objects/texture/wrap_texture.h"
+
+using namespace love;
+
+int Wrap_ParticleSystem::SetTexture(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    Texture* texture     = Wrap_Texture::CheckTexture(L, 2);
+
+    self->SetTexture(texture);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetTexture(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    Luax::PushType(L, self->GetTexture());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetBufferSize(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    lua_Number size      = luaL_checknumber(L, 2);
+
+    if (size < 1.0 || size > ParticleSystem::MAX_PARTICLES)
+        return luaL_error(L, "Invalid buffer size");
+
+    Luax::CatchException(L, [&]() { self->SetBufferSize((uint32_t)size); });
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetBufferSize(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushinteger(L, self->GetBufferSize());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetEmissionRate(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    float rate           = (float)luaL_checknumber(L, 2);
+
+    Luax::CatchException(L, [&]() { self->SetEmissionRate(rate); });
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetEmissionRate(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushnumber(L, self->GetEmissionRate());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetEmitterLifetime(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->SetEmitterLifetime((float)luaL_checknumber(L, 2));
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetEmitterLifetime(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushnumber(L, self->GetEmitterLifetime());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetParticleLifetime(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = (float)luaL_checknumber(L, 2);
+    float max = (float)luaL_optnumber(L, 3, min);
+
+    if (min < 0.0f || max < 0.0f)
+        return luaL_error(L, "Invalid particle lifetime (min = %f, max = %f)", min, max);
+
+    self->SetParticleLifetime(min, max);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetParticleLifetime(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = 0.0f, max = 0.0f;
+    self->GetParticleLifetime(min, max);
+
+    lua_pushnumber(L, min);
+    lua_pushnumber(L, max);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetPosition(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float x = (float)luaL_checknumber(L, 2);
+    float y = (float)luaL_checknumber(L, 3);
+
+    self->SetPosition(x, y);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetPosition(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    const Vector2& position = self->GetPosition();
+
+    lua_pushnumber(L, position.x);
+    lua_pushnumber(L, position.y);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::MoveTo(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float x = (float)luaL_checknumber(L, 2);
+    float y = (float)luaL_checknumber(L, 3);
+
+    self->MoveTo(x, y);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::SetEmissionArea(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    ParticleSystem::AreaSpreadDistribution distribution = ParticleSystem::DISTRIBUTION_NONE;
+    const char* name = luaL_checkstring(L, 2);
+
+    if (!ParticleSystem::GetConstant(name, distribution))
+        return Luax::EnumError(L, "particle distribution",
+                               ParticleSystem::GetConstants(distribution), name);
+
+    float x = 0.0f, y = 0.0f, angle = 0.0f;
+    bool relative = false;
+
+    if (distribution != ParticleSystem::DISTRIBUTION_NONE)
+    {
+        x        = (float)luaL_checknumber(L, 3);
+        y        = (float)luaL_checknumber(L, 4);
+        angle    = (float)luaL_optnumber(L, 5, 0.0);
+        relative = Luax::OptBoolean(L, 6, false);
+
+        if (x < 0.0f || y < 0.0f)
+            return luaL_error(L, "Invalid area spread parameters (must be >= 0)");
+    }
+
+    self->SetEmissionArea(distribution, x, y, angle, relative);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetEmissionArea(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    Vector2 params;
+    float angle   = 0.0f;
+    bool relative = false;
+
+    auto distribution = self->GetEmissionArea(params, angle, relative);
+
+    const char* name = nullptr;
+    ParticleSystem::GetConstant(distribution, name);
+
+    lua_pushstring(L, name);
+    lua_pushnumber(L, params.x);
+    lua_pushnumber(L, params.y);
+    lua_pushnumber(L, angle);
+    lua_pushboolean(L, relative);
+
+    return 5;
+}
+
+int Wrap_ParticleSystem::SetDirection(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->SetDirection((float)luaL_checknumber(L, 2));
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetDirection(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushnumber(L, self->GetDirection());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetSpread(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->SetSpread((float)luaL_checknumber(L, 2));
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetSpread(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushnumber(L, self->GetSpread());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetSpeed(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = (float)luaL_checknumber(L, 2);
+    float max = (float)luaL_optnumber(L, 3, min);
+
+    self->SetSpeed(min, max);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetSpeed(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = 0.0f, max = 0.0f;
+    self->GetSpeed(min, max);
+
+    lua_pushnumber(L, min);
+    lua_pushnumber(L, max);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetLinearAcceleration(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float xmin = (float)luaL_checknumber(L, 2);
+    float ymin = (float)luaL_optnumber(L, 3, 0.0);
+    float xmax = (float)luaL_optnumber(L, 4, xmin);
+    float ymax = (float)luaL_optnumber(L, 5, ymin);
+
+    self->SetLinearAcceleration(xmin, ymin, xmax, ymax);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetLinearAcceleration(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    Vector2 min, max;
+    self->GetLinearAcceleration(min, max);
+
+    lua_pushnumber(L, min.x);
+    lua_pushnumber(L, min.y);
+    lua_pushnumber(L, max.x);
+    lua_pushnumber(L, max.y);
+
+    return 4;
+}
+
+int Wrap_ParticleSystem::SetRadialAcceleration(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = (float)luaL_checknumber(L, 2);
+    float max = (float)luaL_optnumber(L, 3, min);
+
+    self->SetRadialAcceleration(min, max);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetRadialAcceleration(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = 0.0f, max = 0.0f;
+    self->GetRadialAcceleration(min, max);
+
+    lua_pushnumber(L, min);
+    lua_pushnumber(L, max);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetTangentialAcceleration(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = (float)luaL_checknumber(L, 2);
+    float max = (float)luaL_optnumber(L, 3, min);
+
+    self->SetTangentialAcceleration(min, max);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetTangentialAcceleration(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = 0.0f, max = 0.0f;
+    self->GetTangentialAcceleration(min, max);
+
+    lua_pushnumber(L, min);
+    lua_pushnumber(L, max);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetLinearDamping(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = (float)luaL_checknumber(L, 2);
+    float max = (float)luaL_optnumber(L, 3, min);
+
+    self->SetLinearDamping(min, max);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetLinearDamping(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = 0.0f, max = 0.0f;
+    self->GetLinearDamping(min, max);
+
+    lua_pushnumber(L, min);
+    lua_pushnumber(L, max);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetSizes(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    size_t count         = lua_gettop(L) - 1;
+
+    if (count > ParticleSystem::MAX_SIZES)
+        return luaL_error(L, "At most %d sizes may be used.", (int)ParticleSystem::MAX_SIZES);
+
+    std::vector<float> sizes(count);
+
+    for (size_t index = 0; index < count; index++)
+        sizes[index] = (float)luaL_checknumber(L, index + 2);
+
+    Luax::CatchException(L, [&]() { self->SetSizes(sizes); });
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetSizes(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    const std::vector<float>& sizes = self->GetSizes();
+
+    for (float size : sizes)
+        lua_pushnumber(L, size);
+
+    return sizes.size();
+}
+
+int Wrap_ParticleSystem::SetSizeVariation(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    float variation      = (float)luaL_checknumber(L, 2);
+
+    if (variation < 0.0f || variation > 1.0f)
+        return luaL_error(L, "Size variation has to be between 0 and 1, inclusive.");
+
+    self->SetSizeVariation(variation);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetSizeVariation(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushnumber(L, self->GetSizeVariation());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetRotation(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = (float)luaL_checknumber(L, 2);
+    float max = (float)luaL_optnumber(L, 3, min);
+
+    self->SetRotation(min, max);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetRotation(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = 0.0f, max = 0.0f;
+    self->GetRotation(min, max);
+
+    lua_pushnumber(L, min);
+    lua_pushnumber(L, max);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetSpin(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float start = (float)luaL_checknumber(L, 2);
+    float end   = (float)luaL_optnumber(L, 3, start);
+
+    self->SetSpin(start, end);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetSpin(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float start = 0.0f, end = 0.0f;
+    self->GetSpin(start, end);
+
+    lua_pushnumber(L, start);
+    lua_pushnumber(L, end);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetSpinVariation(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->SetSpinVariation((float)luaL_checknumber(L, 2));
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetSpinVariation(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushnumber(L, self->GetSpinVariation());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetOffset(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float x = (float)luaL_checknumber(L, 2);
+    float y = (float)luaL_checknumber(L, 3);
+
+    self->SetOffset(x, y);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetOffset(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    const Vector2& offset = self->GetOffset();
+
+    lua_pushnumber(L, offset.x);
+    lua_pushnumber(L, offset.y);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetColors(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    std::vector<Colorf> colors;
+
+    if (lua_istable(L, 2))
+    {
+        int count = lua_gettop(L) - 1;
+
+        for (int index = 0; index < count; index++)
+        {
+            luaL_checktype(L, index + 2, LUA_TTABLE);
+
+            for (int component = 1; component <= 4; component++)
+                lua_rawgeti(L, index + 2, component);
+
+            Colorf color;
+
+            color.r = (float)luaL_checknumber(L, -4);
+            color.g = (float)luaL_checknumber(L, -3);
+            color.b = (float)luaL_checknumber(L, -2);
+            color.a = (float)luaL_optnumber(L, -1, 1.0);
+
+            colors.push_back(color);
+
+            lua_pop(L, 4);
+        }
+    }
+    else
+    {
+        int count = lua_gettop(L) - 1;
+
+        if (count % 4 != 0 || count == 0)
+            return luaL_error(L, "Expected red, green, blue, and alpha. Only got %d of 4 "
+                                 "components.",
+                              count % 4);
+
+        for (int index = 0; index < count / 4; index++)
+        {
+            Colorf color;
+
+            color.r = (float)luaL_checknumber(L, index * 4 + 2);
+            color.g = (float)luaL_checknumber(L, index * 4 + 3);
+            color.b = (float)luaL_checknumber(L, index * 4 + 4);
+            color.a = (float)luaL_checknumber(L, index * 4 + 5);
+
+            colors.push_back(color);
+        }
+    }
+
+    Luax::CatchException(L, [&]() { self->SetColors(colors); });
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetColors(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    const std::vector<Colorf>& colors = self->GetColors();
+
+    for (const Colorf& color : colors)
+    {
+        lua_createtable(L, 4, 0);
+
+        lua_pushnumber(L, color.r);
+        lua_rawseti(L, -2, 1);
+        lua_pushnumber(L, color.g);
+        lua_rawseti(L, -2, 2);
+        lua_pushnumber(L, color.b);
+        lua_rawseti(L, -2, 3);
+        lua_pushnumber(L, color.a);
+        lua_rawseti(L, -2, 4);
+    }
+
+    return colors.size();
+}
+
+int Wrap_ParticleSystem::SetRelativeRotation(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->SetRelativeRotation(Luax::CheckBoolean(L, 2));
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::HasRelativeRotation(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    Luax::PushBoolean(L, self->HasRelativeRotation());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::GetCount(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushinteger(L, self->GetCount());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::Start(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->Start();
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::Stop(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->Stop();
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::Pause(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->Pause();
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::Reset(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->Reset();
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::Emit(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    int count            = (int)luaL_checkinteger(L, 2);
+
+    self->Emit((uint32_t)std::max(count, 0));
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::IsActive(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    Luax::PushBoolean(L, self->IsActive());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::IsPaused(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    Luax::PushBoolean(L, self->IsPaused());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::IsStopped(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    Luax::PushBoolean(L, self->IsStopped());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::Update(lua_State* L)
+{
+    ParticleSystem* self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    float dt             = (float)luaL_checknumber(L, 2);
+
+    Luax::CatchException(L, [&]() { self->Update(dt); });
+
+    return 0;
+}
+
+ParticleSystem* Wrap_ParticleSystem::CheckParticleSystem(lua_State* L, int index)
+{
+    return Luax::CheckType<ParticleSystem>(L, index);
+}
+
+// clang-format off
+static constexpr luaL_Reg functions[] =
+{
+    { "emit",                      Wrap_ParticleSystem::Emit                      },
+    { "getBufferSize",             Wrap_ParticleSystem::GetBufferSize             },
+    { "getColors",                 Wrap_ParticleSystem::GetColors                 },
+    { "getCount",                  Wrap_ParticleSystem::GetCount                  },
+    { "getDirection",              Wrap_ParticleSystem::GetDirection              },
+    { "getEmissionArea",           Wrap_ParticleSystem::GetEmissionArea           },
+    { "getEmissionRate",           Wrap_ParticleSystem::GetEmissionRate           },
+    { "getEmitterLifetime",        Wrap_ParticleSystem::GetEmitterLifetime        },
+    { "getLinearAcceleration",     Wrap_ParticleSystem::GetLinearAcceleration     },
+    { "getLinearDamping",          Wrap_ParticleSystem::GetLinearDamping          },
+    { "getOffset",                 Wrap_ParticleSystem::GetOffset                 },
+    { "getParticleLifetime",       Wrap_ParticleSystem::GetParticleLifetime       },
+    { "getPosition",               Wrap_ParticleSystem::GetPosition               },
+    { "getRadialAcceleration",     Wrap_ParticleSystem::GetRadialAcceleration     },
+    { "getRotation",               Wrap_ParticleSystem::GetRotation               },
+    { "getSizes",                  Wrap_ParticleSystem::GetSizes                  },
+    { "getSizeVariation",          Wrap_ParticleSystem::GetSizeVariation          },
+    { "getSpeed",                  Wrap_ParticleSystem::GetSpeed                  },
+    { "getSpin",                   Wrap_ParticleSystem::GetSpin                   },
+    { "getSpinVariation",          Wrap_ParticleSystem::GetSpinVariation          },
+    { "getSpread",                 Wrap_ParticleSystem::GetSpread                 },
+    { "getTangentialAcceleration", Wrap_ParticleSystem::GetTangentialAcceleration },
+    { "getTexture",                Wrap_ParticleSystem::GetTexture                },
+    { "hasRelativeRotation",       Wrap_ParticleSystem::HasRelativeRotation       },
+    { "isActive",                  Wrap_ParticleSystem::IsActive                  },
+    { "isPaused",                  Wrap_ParticleSystem::IsPaused                  },
+    { "isStopped",                 Wrap_ParticleSystem::IsStopped                 },
+    { "moveTo",                    Wrap_ParticleSystem::MoveTo                    },
+    { "pause",                     Wrap_ParticleSystem::Pause                     },
+    { "reset",                     Wrap_ParticleSystem::Reset                     },
+    { "setBufferSize",             Wrap_ParticleSystem::SetBufferSize             },
+    { "setColors",                 Wrap_ParticleSystem::SetColors                 },
+    { "setDirection",              Wrap_ParticleSystem::SetDirection              },
+    { "setEmissionArea",           Wrap_ParticleSystem::SetEmissionArea           },
+    { "setEmissionRate",           Wrap_ParticleSystem::SetEmissionRate           },
+    { "setEmitterLifetime",        Wrap_ParticleSystem::SetEmitterLifetime        },
+    { "setLinearAcceleration",     Wrap_ParticleSystem::SetLinearAcceleration     },
+    { "setLinearDamping",          Wrap_ParticleSystem::SetLinearDamping          },
+    { "setOffset",                 Wrap_ParticleSystem::SetOffset                 },
+    { "setParticleLifetime",       Wrap_ParticleSystem::SetParticleLifetime       },
+    { "setPosition",               Wrap_ParticleSystem::SetPosition               },
+    { "setRadialAcceleration",     Wrap_ParticleSystem::SetRadialAcceleration     },
+    { "setRelativeRotation",       Wrap_ParticleSystem::SetRelativeRotation       },
+    { "setRotation",               Wrap_ParticleSystem::SetRotation               },
+    { "setSizes",                  Wrap_ParticleSystem::SetSizes                  },
+    { "setSizeVariation",          Wrap_ParticleSystem::SetSizeVariation          },
+    { "setSpeed",                  Wrap_ParticleSystem::SetSpeed                  },
+    { "setSpin",                   Wrap_ParticleSystem::SetSpin                   },
+    { "setSpinVariation",          Wrap_ParticleSystem::SetSpinVariation          },
+    { "setSpread",                 Wrap_ParticleSystem::SetSpread                 },
+    { "setTangentialAcceleration", Wrap_ParticleSystem::SetTangentialAcceleration },
+    { "setTexture",                Wrap_ParticleSystem::SetTexture                },
+    { "start",                     Wrap_ParticleSystem::Start                     },
+    { "stop",                      Wrap_ParticleSystem::Stop                      },
+    { "update",                    Wrap_ParticleSystem::Update                    },
+    { 0,                           0                                              }
+};
+// clang-format on
+
+int Wrap_ParticleSystem::Register(lua_State* L)
+{
+    return Luax::RegisterType(L, &ParticleSystem::type, functions, nullptr);
+}
@@ -0,0 +1,133 @@
+#include "objects/spritebatch/spritebatchc.h"
+
+#include <algorithm>
+
+love::Type love::common::SpriteBatch::type("SpriteBatch", &Drawable::type);
+
+using namespace love::common;
+
+SpriteBatch::SpriteBatch(love::Texture* texture, int size, vertex::Usage usage) :
+    texture(texture),
+    size(size),
+    next(0),
+    color(1.0f, 1.0f, 1.0f, 1.0f),
+    colorActive(false),
+    usage(usage),
+    rangeStart(-1),
+    rangeCount(-1)
+{
+    if (size <= 0)
+        throw love::Exception("Invalid SpriteBatch size.");
+
+    if (texture == nullptr)
+        throw love::Exception("A texture must be used when creating a SpriteBatch.");
+}
+
+SpriteBatch::~SpriteBatch()
+{}
+
+int SpriteBatch::Add(const Matrix4& transform, int index)
+{
+    return this->Add(this->texture->GetQuad(), transform, index);
+}
+
+int SpriteBatch::GetAddIndex(int index)
+{
+    if (index < -1 || index >= this->next)
+        throw love::Exception("Invalid sprite index: %d", index + 1);
+
+    if (index == -1 && this->next >= this->size)
+        this->SetBufferSize(this->size * 2);
+
+    return (index == -1) ? this->next : index;
+}
+
+void SpriteBatch::Clear()
+{
+    this->next = 0;
+}
+
+void SpriteBatch::SetTexture(love::Texture* texture)
+{
+    this->texture.Set(texture);
+}
+
+love::Texture* SpriteBatch::GetTexture() const
+{
+    return this->texture.Get();
+}
+
+void SpriteBatch::SetColor(const Colorf& color)
+{
+    this->colorActive = true;
+
+    this->color.r = std::clamp(color.r, 0.0f, 1.0f);
+    this->color.g = std::clamp(color.g, 0.0f, 1.0f);
+    this->color.b = std::clamp(color.b, 0.0f, 1.0f);
+    this->color.a = std::clamp(color.a, 0.0f, 1.0f);
+}
+
+void SpriteBatch::SetColor()
+{
+    this->colorActive = false;
+    this->color       = Colorf(1.0f, 1.0f, 1.0f, 1.0f);
+}
+
+Colorf SpriteBatch::GetColor(bool& active) const
+{
+    active = this->colorActive;
+
+    return this->color;
+}
+
+int SpriteBatch::GetCount() const
+{
+    return this->next;
+}
+
+int SpriteBatch::GetBufferSize() const
+{
+    return this->size;
+}
+
+vertex::Usage SpriteBatch::GetUsage() const
+{
+    return this->usage;
+}
+
+void SpriteBatch::SetDrawRange(int start, int count)
+{
+    if (start < 0 || count <= 0)
+        throw love::Exception("Invalid draw range.");
+
+    this->rangeStart = start;
+    this->rangeCount = count;
+}
+
+void SpriteBatch::SetDrawRange()
+{
+    this->rangeStart = this->rangeCount = -1;
+}
+
+bool SpriteBatch::GetDrawRange(int& start, int& count) const
+{
+    if (this->rangeStart < 0 || this->rangeCount <= 0)
+        return false;
+
+    start = this->rangeStart;
+    count = this->rangeCount;
+
+    return true;
+}
+
+void SpriteBatch::GetDrawSpan(int& start, int& count) const
+{
+    start = 0;
+    count = this->next;
+
+    if (this->rangeStart >= 0 && this->rangeCount > 0)
+    {
+        start = std::min(this->rangeStart, this->next);
+        count = std::min(this->rangeCount, this->next - start);
+    }
+}
@@ -0,0 +1,227 @@
+#include "objects/spritebatch/wrap_spritebatch.h"
+
+#include "modules/graphics/graphics.h"
+#include "objects/texture/wrap_texture.h"
+
+using namespace love;
+
+/*
+** add and set share the same arguments,
+** with an optional Quad before the transform
+*/
+static int AddOrSet(lua_State* L, SpriteBatch* self, int start, int index)
+{
+    Quad* quad = nullptr;
+
+    if (Luax::IsType(L, start, Quad::type))
+    {
+        quad = Luax::ToType<Quad>(L, start);
+        start++;
+    }
+    else if (lua_isnil(L, start) && !lua_isnoneornil(L, start + 1))
+        return Luax::TypeErrror(L, start, "Quad");
+
+    Graphics::CheckStandardTransform(L, start, [&](const Matrix4& m) {
+        Luax::CatchException(L, [&]() {
+            if (quad)
+                index = self->Add(quad, m, index);
+            else
+                index = self->Add(m, index);
+        });
+    });
+
+    return index;
+}
+
+int Wrap_SpriteBatch::Add(lua_State* L)
+{
+    SpriteBatch* self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    int index = AddOrSet(L, self, 2, -1);
+
+    lua_pushinteger(L, index + 1);
+
+    return 1;
+}
+
+int Wrap_SpriteBatch::Set(lua_State* L)
+{
+    SpriteBatch* self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+    int index         = (int)luaL_checkinteger(L, 2) - 1;
+
+    AddOrSet(L, self, 3, index);
+
+    return 0;
+}
+
+int Wrap_SpriteBatch::Clear(lua_State* L)
+{
+    SpriteBatch* self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    self->Clear();
+
+    return 0;
+}
+
+int Wrap_SpriteBatch::Flush(lua_State* L)
+{
+    SpriteBatch* self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    Luax::CatchException(L, [&]() { self->Flush(); });
+
+    return 0;
+}
+
+int Wrap_SpriteBatch::SetTexture(lua_State* L)
+{
+    SpriteBatch* self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+    Texture* texture  = Wrap_Texture::CheckTexture(L, 2);
+
+    Luax::CatchException(L, [&]() { self->SetTexture(texture); });
+
+    return 0;
+}
+
+int Wrap_SpriteBatch::GetTexture(lua_State* L)
+{
+    SpriteBatch* self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    Luax::PushType(L, self->GetTexture());
+
+    return 1;
+}
+
+int Wrap_SpriteBatch::SetColor(lua_State* L)
+{
+    SpriteBatch* self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    if (lua_gettop(L) <= 1)
+    {
+        self->SetColor();
+        return 0;
+    }
+
+    Colorf color = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    if (lua_istable(L, 2))
+    {
+        for (int i = 1; i <= 4; i++)
+            lua_rawgeti(L, 2, i);
+
+        color.r = luaL_checknumber(L, -4);
+        color.g = luaL_checknumber(L, -3);
+        color.b = luaL_checknumber(L, -2);
+        color.a = luaL_optnumber(L, -1, 1.0f);
+
+        lua_pop(L, 4);
+    }
+    else
+    {
+        color.r = luaL_checknumber(L, 2);
+        color.g = luaL_checknumber(L, 3);
+        color.b = luaL_checknumber(L, 4);
+        color.a = luaL_optnumber(L, 5, 1.0f);
+    }
+
+    self->SetColor(color);
+
+    return 0;
+}
+
+int Wrap_SpriteBatch::GetColor(lua_State* L)
+{
+    SpriteBatch* self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    bool active  = false;
+    Colorf color = self->GetColor(active);
+
+    if (!active)
+        return 0;
+
+    lua_pushnumber(L, color.r);
+    lua_pushnumber(L, color.g);
+    lua_pushnumber(L, color.b);
+    lua_pushnumber(L, color.a);
+
+    return 4;
+}
+
+int Wrap_SpriteBatch::GetCount(lua_State* L)
+{
+    SpriteBatch* self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    lua_pushinteger(L, self->GetCount());
+
+    return 1;
+}
+
+int Wrap_SpriteBatch::GetBufferSize(lua_State* L)
+{
+    SpriteBatch* self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    lua_pushinteger(L, self->GetBufferSize());
+
+    return 1;
+}
+
+int Wrap_SpriteBatch::SetDrawRange(lua_State* L)
+{
+    SpriteBatch* self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    if (lua_isnoneornil(L, 2))
+        self->SetDrawRange();
+    else
+    {
+        int start = (int)luaL_checkinteger(L, 2) - 1;
+        int count = (int)luaL_checkinteger(L, 3);
+
+        Luax::CatchException(L, [&]() { self->SetDrawRange(start, count); });
+    }
+
+    return 0;
+}
+
+int Wrap_SpriteBatch::GetDrawRange(lua_State* L)
+{
+    SpriteBatch* self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    int start = 0;
+    int count = 1;
+
+    if (!self->GetDrawRange(start, count))
+        return 0;
+
+    lua_pushinteger(L, start + 1);
+    lua_pushinteger(L, count);
+
+    return 2;
+}
+
+SpriteBatch* Wrap_SpriteBatch::CheckSpriteBatch(lua_State* L, int index)
+{
+    return Luax::CheckType<SpriteBatch>(L, index);
+}
+
+// clang-format off
+static constexpr luaL_Reg functions[] =
+{
+    { "add",           Wrap_SpriteBatch::Add           },
+    { "clear",         Wrap_SpriteBatch::Clear         },
+    { "flush",         Wrap_SpriteBatch::Flush         },
+    { "getBufferSize", Wrap_SpriteBatch::GetBufferSize },
+    { "getColor",      Wrap_SpriteBatch::GetColor      },
+    { "getCount",      Wrap_SpriteBatch::GetCount      },
+    { "getDrawRange",  Wrap_SpriteBatch::GetDrawRange  },
+    { "getTexture",    Wrap_SpriteBatch::GetTexture    },
+    { "set",           Wrap_SpriteBatch::Set           },
+    { "setColor",      Wrap_SpriteBatch::SetColor      },
+    { "setDrawRange",  Wrap_SpriteBatch::SetDrawRange  },
+    { "setTexture",    Wrap_SpriteBatch::SetTexture    },
+    { 0,               0                               }
+};
+// clang-format on
+
+int Wrap_SpriteBatch::Register(lua_State* L)
+{
+    return Luax::RegisterType(L, &SpriteBatch::type, functions, nullptr);
+}
@@ -9,17 +9,29 @@ Texture::Filter Texture::defaultFilter;
 Texture::FilterMode Texture::defaultMipmapFilter = Texture::FILTER_LINEAR;
 float Texture::defaultMipmapSharpness            = 0.0f;
 
+int64_t Texture::totalGraphicsMemory = 0;
+
 Texture::Texture(TextureType texType) :
     texType(texType),
     width(0),
     height(0),
     filter(defaultFilter),
     mipmapCount(1),
-    wrap()
+    wrap(),
+    graphicsMemorySize(0)
 {}
 
 Texture::~Texture()
-{}
+{
+    this->SetGraphicsMemorySize(0);
+}
+
+void Texture::SetGraphicsMemorySize(int64_t bytes)
+{
+    totalGraphicsMemory -= this->graphicsMemorySize;
+    this->graphicsMemorySize = bytes;
+    totalGraphicsMemory += bytes;
+}
 
 void Texture::InitQuad()
 {
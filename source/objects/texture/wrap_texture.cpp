@@ -48,6 +48,15 @@ int Wrap_Texture::GetDimensions(lua_State* L)
     return 2;
 }
 
+int Wrap_Texture::GetMipmapCount(lua_State* L)
+{
+    love::Texture* self = Wrap_Texture::CheckTexture(L, 1);
+
+    lua_pushinteger(L, self->GetMipmapCount());
+
+    return 1;
+}
+
 int Wrap_Texture::SetFilter(lua_State* L)
 {
     love::Texture* self = Wrap_Texture::CheckTexture(L, 1);
@@ -145,12 +154,13 @@ love::Texture* Wrap_Texture::CheckTexture(lua_State* L, int index)
 }
 
 // clang-format off
-const luaL_Reg Wrap_Texture::functions[9] =
+const luaL_Reg Wrap_Texture::functions[10] =
 {
     { "getTextureType", GetTextureType },
     { "getWidth",       GetWidth       },
     { "getHeight",      GetHeight      },
     { "getDimensions",  GetDimensions  },
+    { "getMipmapCount", GetMipmapCount },
     { "setFilter",      SetFilter      },
     { "getFilter",      GetFilter      },
     { "setWrap",        SetWrap        },
@@ -0,0 +1,72 @@
+/*
+** Times ParticleSystem::Update with 10k live particles, with every
+** per-particle feature of the simulation turned on
+*/
+#include "objects/particlesystem/particlesystemc.h"
+#include "objects/texture/texture.h"
+
+#include <chrono>
+#include <cstdio>
+
+love::Type love::Texture::type("Texture", &love::Drawable::type);
+
+namespace
+{
+    constexpr uint32_t PARTICLES = 10000;
+    constexpr int WARMUP         = 60;
+    constexpr int UPDATES        = 1000;
+    constexpr float DELTA        = 1.0f / 60.0f;
+
+    class ParticleSystem : public love::common::ParticleSystem
+    {
+      public:
+        using love::common::ParticleSystem::ParticleSystem;
+
+        void Draw(love::Graphics*, const love::Matrix4&) override
+        {}
+    };
+} // namespace
+
+int main()
+{
+    love::Texture texture(8, 8);
+    ParticleSystem system(&texture, PARTICLES);
+
+    /* long enough that nothing dies while being timed */
+    system.SetParticleLifetime(1000.0f, 1000.0f);
+    system.SetSpeed(20.0f, 80.0f);
+    system.SetSpread(LOVE_M_PI * 2.0f);
+    system.SetLinearAcceleration(-10.0f, -10.0f, 10.0f, 10.0f);
+    system.SetRadialAcceleration(-5.0f, 5.0f);
+    system.SetTangentialAcceleration(-5.0f, 5.0f);
+    system.SetLinearDamping(0.1f, 0.5f);
+    system.SetSizes({ 1.0f, 2.0f, 0.5f });
+    system.SetSpin(-2.0f, 2.0f);
+    system.SetColors({ { 1.0f, 1.0f, 1.0f, 1.0f }, { 1.0f, 0.5f, 0.0f, 0.0f } });
+
+    system.Emit(PARTICLES);
+
+    for (int frame = 0; frame < WARMUP; frame++)
+        system.Update(DELTA);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int frame = 0; frame < UPDATES; frame++)
+        system.Update(DELTA);
+
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+    if (system.GetCount() != PARTICLES)
+    {
+        std::printf("particles: %u live after updating, expected %u\n", system.GetCount(),
+                    PARTICLES);
+        return 1;
+    }
+
+    double perUpdate = elapsed.count() / UPDATES;
+
+    std::printf("particles: %u live, %.1f us per update, %.2f ns per particle\n", PARTICLES,
+                perUpdate, perUpdate * 1000.0 / PARTICLES);
+
+    return 0;
+}
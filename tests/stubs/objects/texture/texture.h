@@ -0,0 +1,33 @@
+#pragma once
+
+#include "objects/drawable/drawable.h"
+
+namespace love
+{
+    /* Only the size, which is all a ParticleSystem reads */
+    class Texture : public Drawable
+    {
+      public:
+        static love::Type type;
+
+        Texture(int width, int height) : width(width), height(height)
+        {}
+
+        int GetWidth() const
+        {
+            return this->width;
+        }
+
+        int GetHeight() const
+        {
+            return this->height;
+        }
+
+        void Draw(Graphics*, const Matrix4&) override
+        {}
+
+      private:
+        int width;
+        int height;
+    };
+} // namespace love